@@ -0,0 +1,78 @@
+/**
+ * @file bench_main.cpp
+ * @author Matthew Brown
+ * @brief Entry point of chess_engine_bench
+ *
+ * Usage: chess_engine_bench [benchmark] [depth]
+ * Without a benchmark name every benchmark is run.
+ */
+#include "benchmarks.h"
+
+#include <functional>
+#include <iostream>
+#include <string>
+
+using namespace chessengine::bench;
+
+namespace
+{
+
+struct Benchmark
+{
+    std::string name;
+    std::string description;
+    int defaultDepth;
+    std::function<void(int)> run;
+};
+
+const Benchmark BENCHMARKS[] = {
+        {"makemove", "ChessGame make/unmake against copy-make over a tree walk", 4, runMakeMoveBenchmark},
+        {"smp", "nodes per second and time to depth of the search with 1 to 32 threads", 7, runSmpBenchmark},
+        {"pruning", "nodes and time saved by each selective search technique", 7, runPruningBenchmark},
+        {"nnue", "network evaluations per second with each set of kernels", 3, runNnueBenchmark},
+        {"sliders", "slider lookups and perft speed with the magic and PEXT backends", 4, runSliderBenchmark},
+};
+
+void printUsage()
+{
+    std::cout << "Usage: chess_engine_bench [benchmark] [depth]\n\nBenchmarks:\n";
+    for (const Benchmark &benchmark: BENCHMARKS)
+    {
+        std::cout << "  " << benchmark.name << " - " << benchmark.description << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::string name = argc > 1 ? argv[1] : "";
+    if (name == "-h" or name == "--help")
+    {
+        printUsage();
+        return 0;
+    }
+
+    bool found = false;
+    for (const Benchmark &benchmark: BENCHMARKS)
+    {
+        if (!name.empty() and name != benchmark.name)
+        {
+            continue;
+        }
+
+        found = true;
+        const int depth = argc > 2 ? std::stoi(argv[2]) : benchmark.defaultDepth;
+        std::cout << "== " << benchmark.name << " (depth " << depth << ") ==" << std::endl;
+        benchmark.run(depth);
+    }
+
+    if (!found)
+    {
+        std::cerr << "Unknown benchmark " << name << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    return 0;
+}
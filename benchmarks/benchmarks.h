@@ -0,0 +1,60 @@
+/**
+ * @file benchmarks.h
+ * @author Matthew Brown
+ * @brief Benchmarks run by chess_engine_bench
+ */
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace chessengine::bench
+{
+
+/** Positions most benchmarks run over */
+inline const std::vector<std::string> BENCH_POSITIONS = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+};
+
+/** Seconds elapsed since a starting time point */
+inline double getSecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/** Time ChessGame make/unmake and copy-make of every legal move over a tree walk
+ *
+ * @param depth Depth of the tree walked in every bench position
+ */
+void runMakeMoveBenchmark(int depth);
+
+/** Report how the Lazy SMP search scales from 1 to 32 threads
+ *
+ * @param depth Depth every bench position is searched to
+ */
+void runSmpBenchmark(int depth);
+
+/** Report the nodes and time each selective search technique saves
+ *
+ * @param depth Depth every bench position is searched to
+ */
+void runPruningBenchmark(int depth);
+
+/** Report the evaluations per second of the network with every set of kernels the processor supports
+ *
+ * @param depth Depth of the tree walked in every bench position
+ */
+void runNnueBenchmark(int depth);
+
+/** Compare the slider lookups and move generation of the magic and PEXT backends
+ *
+ * @param depth Depth of the perft of every bench position
+ */
+void runSliderBenchmark(int depth);
+
+} // namespace chessengine::bench
@@ -0,0 +1,100 @@
+/**
+ * @file make_move_bench.cpp
+ * @author Matthew Brown
+ * @brief Time ChessGame make/unmake against copy-make
+ *
+ * The tree is walked with ChessGame for move generation, and at every node all legal moves are
+ * made and taken back several times, so move generation is not part of the time. A CopyMakeStack
+ * follows the walk and makes the same moves at every node with copy-make.
+ */
+#include "benchmarks.h"
+
+#include "chess_engine/chess_game.h"
+#include "chess_engine/copy_make.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+namespace
+{
+
+/* How often the moves of a node are made, to get above the timer resolution */
+constexpr int REPEATS = 8;
+
+struct MakeMoveTimes
+{
+    double makeUnmake = 0;
+    double copyMake = 0;
+    uint64_t moves = 0;
+    uint64_t checksum = 0; // Printed so the compiler can't drop the work
+};
+
+void walkTree(ChessGame &game, CopyMakeStack &stack, int depth, MakeMoveTimes &times)
+{
+    MoveList moves;
+    game.generateLegalMoves(moves);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < REPEATS; ++repeat)
+    {
+        for (const Move move: moves)
+        {
+            game.makeMove(move);
+            times.checksum += game.getHashKey();
+            game.unmakeMove();
+        }
+    }
+    times.makeUnmake += bench::getSecondsSince(start);
+    times.moves += moves.getSize() * REPEATS;
+
+    const auto copyStart = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < REPEATS; ++repeat)
+    {
+        for (const Move move: moves)
+        {
+            stack.makeMove(move);
+            times.checksum += stack.getBoard().hashKey;
+            stack.unmakeMove();
+        }
+    }
+    times.copyMake += bench::getSecondsSince(copyStart);
+
+    if (depth <= 1)
+    {
+        return;
+    }
+
+    for (const Move move: moves)
+    {
+        game.makeMove(move);
+        stack.makeMove(move);
+        walkTree(game, stack, depth - 1, times);
+        stack.unmakeMove();
+        game.unmakeMove();
+    }
+}
+
+} // namespace
+
+void chessengine::bench::runMakeMoveBenchmark(int depth)
+{
+    MakeMoveTimes times;
+    for (const std::string &fen: BENCH_POSITIONS)
+    {
+        ChessGame game;
+        game.createFromFEN(fen);
+        CopyMakeStack stack(game);
+        walkTree(game, stack, depth, times);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Moves made:   " << times.moves << "\n";
+    std::cout << "Make/unmake:  " << times.makeUnmake * 1e9 / static_cast<double>(times.moves)
+              << " ns per move (ChessBoard, " << sizeof(ChessBoard) << " bytes)\n";
+    std::cout << "Copy-make:    " << times.copyMake * 1e9 / static_cast<double>(times.moves)
+              << " ns per move (CopyMakeStack)\n";
+    std::cout << "Checksum:     " << times.checksum << std::endl;
+}
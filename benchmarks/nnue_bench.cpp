@@ -0,0 +1,126 @@
+/**
+ * @file nnue_bench.cpp
+ * @author Matthew Brown
+ * @brief Evaluations per second of the network with each set of kernels
+ *
+ * A random network is written to a temporary file and memory mapped. For every kernel set
+ * the bench positions are evaluated from their accumulators over and over, then the tree of
+ * every bench position is walked with make/unmake, updating the accumulator and evaluating
+ * every node. The piece-square table evaluation walks the same trees for comparison.
+ */
+#include "benchmarks.h"
+
+#include "chess_engine/board/nnue.h"
+#include "chess_engine/chess_game.h"
+
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace chessengine;
+using namespace chessengine::bench;
+
+namespace
+{
+
+/* Evaluations of each position in the evaluation only run */
+constexpr unsigned EVALUATION_REPEATS = 200000;
+
+/** Walk the tree, evaluating every node
+ *
+ * @param game Game to walk
+ * @param depth Depth left
+ * @param nodes Nodes evaluated so far
+ * @return Sum of the evaluations, keeps them from being optimized away
+ */
+int64_t walkTree(ChessGame &game, const int depth, uint64_t &nodes)
+{
+    ++nodes;
+    int64_t sum = game.evaluate();
+    if (depth == 0)
+    {
+        return sum;
+    }
+
+    board::MoveList moves;
+    game.generateLegalMoves(moves);
+    for (const board::Move move: moves)
+    {
+        game.makeMove(move);
+        sum += walkTree(game, depth - 1, nodes);
+        game.unmakeMove();
+    }
+
+    return sum;
+}
+
+/** Walk every bench position and print the evaluations per second
+ *
+ * @param name Name of the row
+ * @param network Network to evaluate with, nullptr for the piece-square tables
+ * @param depth Depth of the walk
+ * @param evaluationRate Evaluations per second without moves, printed before the walk
+ * @param checksum Sum of the evaluations without moves, printed so they aren't optimized away
+ */
+void printTreeWalk(const std::string &name, const board::Network *network, const int depth,
+                   const double evaluationRate, int64_t checksum)
+{
+    uint64_t nodes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const std::string &fen: BENCH_POSITIONS)
+    {
+        ChessGame game;
+        game.createFromFEN(fen);
+        game.setNetwork(network);
+        checksum += walkTree(game, depth, nodes);
+    }
+    const double seconds = getSecondsSince(start);
+
+    std::cout << std::fixed << std::setprecision(0) << std::setw(10) << name << std::setw(16) << evaluationRate
+              << std::setw(16) << static_cast<double>(nodes) / seconds << std::setw(16) << checksum << std::endl;
+}
+
+} // namespace
+
+void chessengine::bench::runNnueBenchmark(int depth)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "chess_engine_bench.nnue").string();
+    board::Network::writeRandom(path, 1);
+    const board::Network network(path);
+
+    std::cout << std::setw(10) << "kernels" << std::setw(16) << "evals/s" << std::setw(16) << "walk evals/s"
+              << std::setw(16) << "checksum" << "\n";
+
+    const std::string best = board::getNnueKernels().name;
+    for (const board::NnueKernels *kernels: board::getAvailableNnueKernels())
+    {
+        board::setNnueKernels(kernels->name);
+
+        std::vector<ChessGame> games(BENCH_POSITIONS.size());
+        for (size_t j = 0; j < games.size(); ++j)
+        {
+            games[j].createFromFEN(BENCH_POSITIONS[j]);
+            games[j].setNetwork(&network);
+        }
+
+        int64_t checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < EVALUATION_REPEATS; ++i)
+        {
+            for (const ChessGame &game: games)
+            {
+                checksum += game.evaluate();
+            }
+        }
+        const double seconds = getSecondsSince(start);
+
+        const double evaluationRate = static_cast<double>(EVALUATION_REPEATS * games.size()) / seconds;
+        printTreeWalk(kernels->name, &network, depth, evaluationRate, checksum);
+    }
+
+    board::setNnueKernels(best);
+    printTreeWalk("psqt", nullptr, depth, 0, 0);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file pruning_bench.cpp
+ * @author Matthew Brown
+ * @brief Nodes and time saved by each selective search technique
+ *
+ * Every bench position is searched to the same depth with all techniques on, then with each
+ * one turned off in turn, then with all of them off. Every run starts from an empty
+ * transposition table on a single thread so the node counts can be compared.
+ */
+#include "benchmarks.h"
+
+#include "chess_engine/chess_engine.h"
+#include "chess_engine/chess_game.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace chessengine;
+
+namespace
+{
+
+/* Big enough that the table doesn't fill up at the bench depths */
+constexpr size_t BENCH_HASH_MEGABYTES = 64;
+
+struct PruningRun
+{
+    const char *name;
+    SearchOptions options;
+};
+
+const PruningRun RUNS[] = {
+        {"all on", {}},
+        {"no null move", {.nullMovePruning = false}},
+        {"no lmr", {.lateMoveReductions = false}},
+        {"no rfp", {.reverseFutilityPruning = false}},
+        {"no futility", {.futilityPruning = false}},
+        {"no check ext", {.checkExtensions = false}},
+        {"all off", {false, false, false, false, false}},
+};
+
+} // namespace
+
+void chessengine::bench::runPruningBenchmark(int depth)
+{
+    std::cout << std::setw(14) << "options" << std::setw(14) << "nodes" << std::setw(12) << "time (ms)"
+              << std::setw(12) << "nodes" << "\n";
+
+    ChessEngine engine(BENCH_HASH_MEGABYTES);
+    SearchLimits limits;
+    limits.depth = depth;
+
+    uint64_t baseNodes = 0;
+    for (const PruningRun &run: RUNS)
+    {
+        engine.setSearchOptions(run.options);
+
+        uint64_t nodes = 0;
+        double seconds = 0;
+        for (const std::string &fen: BENCH_POSITIONS)
+        {
+            ChessGame game;
+            game.createFromFEN(fen);
+            engine.newGame();
+
+            const auto start = std::chrono::steady_clock::now();
+            nodes += engine.search(game, limits).info.nodes;
+            seconds += getSecondsSince(start);
+        }
+
+        if (baseNodes == 0)
+        {
+            baseNodes = nodes;
+        }
+
+        std::cout << std::fixed << std::setprecision(2) << std::setw(14) << run.name << std::setw(14) << nodes
+                  << std::setw(12) << seconds * 1000 << std::setw(11)
+                  << static_cast<double>(nodes) / static_cast<double>(baseNodes) << "x" << std::endl;
+    }
+}
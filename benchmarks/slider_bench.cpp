@@ -0,0 +1,124 @@
+/**
+ * @file slider_bench.cpp
+ * @author Matthew Brown
+ * @brief Slider lookups and move generation speed with the magic and PEXT backends
+ *
+ * For every backend the processor supports, the attack tables are rebuilt for it and the
+ * rook and bishop attacks are looked up for random occupancies, then a perft of every bench
+ * position counts the leaves with generateLegalMoves and make/unmake. Both backends must
+ * count the same leaves.
+ */
+#include "benchmarks.h"
+
+#include "chess_engine/board/attack_tables.h"
+#include "chess_engine/chess_game.h"
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace chessengine;
+using namespace chessengine::bench;
+
+namespace
+{
+
+/* Random occupancies looked up from every square */
+constexpr unsigned OCCUPANCIES = 20000;
+
+/** Count the leaves of the tree
+ *
+ * @param game Game to walk
+ * @param depth Depth left
+ * @return Number of positions at depth 0
+ */
+uint64_t perft(ChessGame &game, const int depth)
+{
+    board::MoveList moves;
+    game.generateLegalMoves(moves);
+    if (depth == 1)
+    {
+        return moves.getSize();
+    }
+
+    uint64_t leaves = 0;
+    for (const board::Move move: moves)
+    {
+        game.makeMove(move);
+        leaves += perft(game, depth - 1);
+        game.unmakeMove();
+    }
+
+    return leaves;
+}
+
+/** Time the rook and bishop lookups of one backend
+ *
+ * @param occupancies Occupancies to look up from every square
+ * @param checksum Attacks xored together, printed so they aren't optimized away
+ * @return Lookups per second
+ */
+template<board::SliderBackend Backend>
+double timeLookups(const std::vector<uint64_t> &occupancies, uint64_t &checksum)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (const uint64_t occupied: occupancies)
+    {
+        for (unsigned square = 0; square < 64; ++square)
+        {
+            checksum ^= board::getRookAttacks<Backend>(square, occupied);
+            checksum ^= board::getBishopAttacks<Backend>(square, occupied);
+        }
+    }
+
+    return static_cast<double>(occupancies.size() * 64 * 2) / getSecondsSince(start);
+}
+
+} // namespace
+
+void chessengine::bench::runSliderBenchmark(int depth)
+{
+    std::mt19937_64 random(12345);
+    std::vector<uint64_t> occupancies(OCCUPANCIES);
+    for (uint64_t &occupied: occupancies)
+    {
+        occupied = random() & random();
+    }
+
+    std::cout << std::setw(10) << "backend" << std::setw(16) << "lookups/s" << std::setw(16) << "perft leaves"
+              << std::setw(16) << "leaves/s" << std::setw(20) << "checksum" << "\n";
+
+    const board::SliderBackend selected = board::getSliderBackend();
+    for (const board::SliderBackend backend: {board::SliderBackend::MAGIC, board::SliderBackend::PEXT})
+    {
+        if (!board::setSliderBackend(backend))
+        {
+            std::cout << std::setw(10) << "pext" << "  not supported by this processor\n";
+            continue;
+        }
+
+        uint64_t checksum = 0;
+        const double lookupRate = backend == board::SliderBackend::PEXT
+                                          ? timeLookups<board::SliderBackend::PEXT>(occupancies, checksum)
+                                          : timeLookups<board::SliderBackend::MAGIC>(occupancies, checksum);
+
+        uint64_t leaves = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (const std::string &fen: BENCH_POSITIONS)
+        {
+            ChessGame game;
+            game.createFromFEN(fen);
+            leaves += perft(game, depth);
+        }
+        const double seconds = getSecondsSince(start);
+
+        std::cout << std::fixed << std::setprecision(0) << std::setw(10)
+                  << (backend == board::SliderBackend::PEXT ? "pext" : "magic") << std::setw(16) << lookupRate
+                  << std::setw(16) << leaves << std::setw(16) << static_cast<double>(leaves) / seconds
+                  << std::setw(20) << checksum << std::endl;
+    }
+
+    board::setSliderBackend(selected);
+}
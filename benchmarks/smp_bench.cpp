@@ -0,0 +1,72 @@
+/**
+ * @file smp_bench.cpp
+ * @author Matthew Brown
+ * @brief Scaling of the Lazy SMP search with the number of threads
+ *
+ * Every bench position is searched to the same depth with 1, 2, 4, ... 32 threads, starting
+ * from an empty transposition table each time. Time to depth is the wall clock time until the
+ * main thread finishes the depth, the speedups are relative to the single thread run.
+ */
+#include "benchmarks.h"
+
+#include "chess_engine/chess_engine.h"
+#include "chess_engine/chess_game.h"
+
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace chessengine;
+
+namespace
+{
+
+constexpr unsigned THREAD_COUNTS[] = {1, 2, 4, 8, 16, 32};
+
+/* Big enough that the table doesn't fill up at the bench depths */
+constexpr size_t BENCH_HASH_MEGABYTES = 64;
+
+} // namespace
+
+void chessengine::bench::runSmpBenchmark(int depth)
+{
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << "\n";
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "nodes" << std::setw(12) << "time (ms)" << std::setw(14)
+              << "nps" << std::setw(12) << "nps gain" << std::setw(12) << "ttd gain" << "\n";
+
+    ChessEngine engine(BENCH_HASH_MEGABYTES);
+    SearchLimits limits;
+    limits.depth = depth;
+
+    double baseSeconds = 0;
+    double baseNodesPerSecond = 0;
+    for (const unsigned threads: THREAD_COUNTS)
+    {
+        engine.setThreadCount(threads);
+
+        uint64_t nodes = 0;
+        double seconds = 0;
+        for (const std::string &fen: BENCH_POSITIONS)
+        {
+            ChessGame game;
+            game.createFromFEN(fen);
+            engine.newGame();
+
+            const auto start = std::chrono::steady_clock::now();
+            nodes += engine.search(game, limits).info.nodes;
+            seconds += getSecondsSince(start);
+        }
+
+        const double nodesPerSecond = static_cast<double>(nodes) / seconds;
+        if (threads == 1)
+        {
+            baseSeconds = seconds;
+            baseNodesPerSecond = nodesPerSecond;
+        }
+
+        std::cout << std::fixed << std::setprecision(2) << std::setw(8) << threads << std::setw(14) << nodes
+                  << std::setw(12) << seconds * 1000 << std::setw(14) << static_cast<uint64_t>(nodesPerSecond)
+                  << std::setw(11) << nodesPerSecond / baseNodesPerSecond << "x" << std::setw(11)
+                  << baseSeconds / seconds << "x" << std::endl;
+    }
+}
@@ -0,0 +1,245 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * attack_tables.h - Precomputed attack tables for the pieces
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(_M_X64))
+#include <immintrin.h>
+#endif
+
+namespace chessengine::board
+{
+
+/** Ways of indexing the slider attack tables */
+enum class SliderBackend
+{
+    MAGIC, // Multiply by a magic number, works everywhere
+    PEXT   // BMI2 parallel bit extract, selected at startup when the CPU has a fast one
+};
+
+/* Selected backend, only changed through setSliderBackend. Read once per call to withSliderBackend */
+extern bool usePext;
+
+/** Gather the bits of value selected by mask into the low bits of the result
+ *
+ * Only call this when the CPU supports BMI2. The instruction is emitted directly so the
+ * library can be built for any x86-64 CPU and still use it when it is available.
+ */
+inline uint64_t extractBits(uint64_t value, uint64_t mask)
+{
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(_M_X64))
+    return _pext_u64(value, mask);
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    uint64_t result;
+    asm("pextq %2, %1, %0" : "=r"(result) : "r"(value), "rm"(mask));
+    return result;
+#else
+    // Portable version, never used for lookups since PEXT is only selected on x86-64
+    uint64_t result = 0;
+    for (uint64_t bit = 1; mask; bit <<= 1, mask &= mask - 1)
+    {
+        if (value & mask & -mask)
+        {
+            result |= bit;
+        }
+    }
+    return result;
+#endif
+}
+
+/** Generate the attacks of a piece that jumps to fixed offsets
+ *
+ * Evaluated at compile time, so the leaper tables cost nothing at startup.
+ *
+ * @param steps Jumps of the piece as (rank, column) pairs
+ * @return Attacks of the piece from every square
+ */
+template<std::size_t N>
+consteval std::array<uint64_t, 64> generateLeaperAttacks(const int (&steps)[N][2])
+{
+    std::array<uint64_t, 64> attacks{};
+
+    for (int square = 0; square < 64; ++square)
+    {
+        for (const auto &step: steps)
+        {
+            const int rank = square / 8 + step[0];
+            const int column = square % 8 + step[1];
+
+            if (rank >= 0 and rank < 8 and column >= 0 and column < 8)
+            {
+                attacks[square] |= 1ull << (rank * 8 + column);
+            }
+        }
+    }
+
+    return attacks;
+}
+
+constexpr int KNIGHT_STEPS[8][2] = {{2, 1}, {2, -1}, {1, 2}, {1, -2}, {-1, 2}, {-1, -2}, {-2, 1}, {-2, -1}};
+constexpr int KING_STEPS[8][2] = {{1, 1}, {1, 0}, {1, -1}, {0, 1}, {0, -1}, {-1, 1}, {-1, 0}, {-1, -1}};
+constexpr int WHITE_PAWN_STEPS[2][2] = {{1, 1}, {1, -1}};
+constexpr int BLACK_PAWN_STEPS[2][2] = {{-1, 1}, {-1, -1}};
+
+/* Attacks of the leaping pieces from every square */
+inline constexpr std::array<uint64_t, 64> KNIGHT_ATTACKS = generateLeaperAttacks(KNIGHT_STEPS);
+inline constexpr std::array<uint64_t, 64> KING_ATTACKS = generateLeaperAttacks(KING_STEPS);
+inline constexpr std::array<uint64_t, 64> WHITE_PAWN_ATTACKS = generateLeaperAttacks(WHITE_PAWN_STEPS);
+inline constexpr std::array<uint64_t, 64> BLACK_PAWN_ATTACKS = generateLeaperAttacks(BLACK_PAWN_STEPS);
+
+/** Get the squares attacked by a pawn
+ *
+ * @param color Color of the pawn, true for white
+ * @param square Square the pawn is on
+ * @return Squares the pawn attacks
+ */
+constexpr uint64_t getPawnAttacks(bool color, unsigned int square)
+{
+    return color ? WHITE_PAWN_ATTACKS[square] : BLACK_PAWN_ATTACKS[square];
+}
+
+/** Magic bitboard information for a single square
+ *
+ * The relevant occupancy of a slider (the squares on its rays, not including the
+ * edges of the board) is multiplied by a magic number, the top bits of the result
+ * are a perfect hash into the attacks table for that square.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct Magic
+{
+    /* Squares that can block the slider */
+    uint64_t mask;
+    uint64_t magic;
+    /* Start of the attacks for this square in the shared table */
+    uint64_t *attacks;
+    unsigned int shift;
+
+    /** Get the index into the attacks for the given occupancy
+     *
+     * Both backends produce an index below 2^popcount(mask), so they share the table
+     * layout and only the order of the entries differs. The backend must be the one the
+     * tables were built for.
+     */
+    template<SliderBackend Backend>
+    [[nodiscard]] unsigned int getIndex(uint64_t occupied) const
+    {
+        if constexpr (Backend == SliderBackend::PEXT)
+        {
+            return static_cast<unsigned int>(extractBits(occupied, mask));
+        }
+        else
+        {
+            return static_cast<unsigned int>(((occupied & mask) * magic) >> shift);
+        }
+    }
+};
+
+extern Magic rookMagics[64];
+extern Magic bishopMagics[64];
+
+/* Squares strictly between two squares on the same rank, file or diagonal */
+extern uint64_t squaresBetween[64][64];
+
+void initAttackTables();
+
+[[nodiscard]] bool isPextSupported();
+[[nodiscard]] SliderBackend getSliderBackend();
+bool setSliderBackend(SliderBackend backend);
+
+/** Call a function templated on the selected slider backend
+ *
+ * The backend is read once here, so everything the function calls looks the attacks up
+ * without checking it again. Call it at the entry point of move generation, not per lookup.
+ *
+ * @param function Callable as function.template operator()<Backend>()
+ * @return Whatever the function returns
+ */
+template<typename Function>
+decltype(auto) withSliderBackend(Function &&function)
+{
+    if (usePext)
+    {
+        return function.template operator()<SliderBackend::PEXT>();
+    }
+
+    return function.template operator()<SliderBackend::MAGIC>();
+}
+
+/** Get the attacks of a rook
+ *
+ * @param square Square the rook is on
+ * @param occupied All the pieces on the board
+ * @return Bitboard of every square the rook attacks
+ */
+template<SliderBackend Backend>
+inline uint64_t getRookAttacks(unsigned int square, uint64_t occupied)
+{
+    const Magic &magic = rookMagics[square];
+    return magic.attacks[magic.template getIndex<Backend>(occupied)];
+}
+
+/** Get the attacks of a bishop
+ *
+ * @param square Square the bishop is on
+ * @param occupied All the pieces on the board
+ * @return Bitboard of every square the bishop attacks
+ */
+template<SliderBackend Backend>
+inline uint64_t getBishopAttacks(unsigned int square, uint64_t occupied)
+{
+    const Magic &magic = bishopMagics[square];
+    return magic.attacks[magic.template getIndex<Backend>(occupied)];
+}
+
+/** Get the attacks of a queen
+ *
+ * @param square Square the queen is on
+ * @param occupied All the pieces on the board
+ * @return Bitboard of every square the queen attacks
+ */
+template<SliderBackend Backend>
+inline uint64_t getQueenAttacks(unsigned int square, uint64_t occupied)
+{
+    return getRookAttacks<Backend>(square, occupied) | getBishopAttacks<Backend>(square, occupied);
+}
+
+/** Get the squares between two squares
+ *
+ * @param from First square
+ * @param to Second square
+ * @return Squares strictly between them, nothing if they are not on the same line
+ */
+inline uint64_t getSquaresBetween(unsigned int from, unsigned int to)
+{
+    return squaresBetween[from][to];
+}
+
+} // namespace chessengine::board
@@ -26,6 +26,7 @@
  *****************************************************************************/
 #pragma once
 
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/piece.h"
 
 namespace chessengine
@@ -34,25 +35,64 @@ namespace chessengine
 namespace board
 {
 
-
 /** Bishop class
+ *
+ * Attacks are looked up with the slider backend given as a template parameter.
  *
  * @author Matthew Brown
  * @date 05/28/2024
  */
-class Bishop final : public Piece
+struct Bishop
 {
-public:
-    Bishop(bool color, ChessBoard *board, unsigned int location) : Piece(color, board, location) {}
-    ~Bishop() override = default;
+    static constexpr PieceLoc WHITE_LOCATION = WHITE_BISHOP;
+
+    /** Get the possible attacks for a bishop
+     *
+     * @param square Square of the bishop
+     * @param occupied Every occupied square
+     * @return Squares the bishop attacks
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getAttacks(unsigned int square, uint64_t occupied)
+    {
+        return getBishopAttacks<Backend>(square, occupied);
+    }
+
+    /** Get the legal moves for a bishop
+     *
+     * @param board Board the bishop is on, its check information must be generated
+     * @param square Square of the bishop
+     * @return Squares the bishop may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square)
+    {
+        return getLegalMoves<Color, Backend>(board, square, ~getOwnPieces<Color>(board));
+    }
+
+    /** Get the legal moves for a bishop to a set of target squares
+     *
+     * Used to generate only part of the moves, e.g. only the captures, without filtering afterwards.
+     *
+     * @param board Board the bishop is on, its check information must be generated
+     * @param square Square of the bishop
+     * @param targets Squares the bishop may move to, must not contain own pieces
+     * @return Squares the bishop may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square, uint64_t targets)
+    {
+        const CheckInfo &info = board.board.getCheckInfo(Color);
 
-    void makeMove(int to) override;
-    [[nodiscard]] char getType() const override;
-    void getAttacks(uint64_t &attacks) const override;
-    void getLegalMoves(uint64_t &moves) const override;
+        // Pinned along a rank or file, the bishop can't stay on the pin ray
+        if (info.pinStraight.value & (1ull << square))
+        {
+            return 0;
+        }
 
-    void getBottomLeftTopRightMoves(uint64_t &moves) const;
-    void getBottomRightTopLeftMoves(uint64_t &moves) const;
+        return getBishopAttacks<Backend>(square, board.board.allPieces.value) & targets &
+               info.checkMask.value & info.getPinMask(square);
+    }
 };
 
 } // namespace board
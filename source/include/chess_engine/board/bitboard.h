@@ -26,8 +26,11 @@
  *****************************************************************************/
 #pragma once
 
+#include <bit>
 #include <cstdint>
 
+#include "chess_engine/board/attack_tables.h"
+
 namespace chessengine
 {
 
@@ -40,7 +43,7 @@ namespace board
  * @author Matthew Brown
  * @date 6/6/2024
  */
-enum PieceLoc
+enum PieceLoc : uint8_t
 {
     WHITE_PAWN = 0,
     WHITE_KNIGHT = 1,
@@ -53,7 +56,8 @@ enum PieceLoc
     BLACK_BISHOP = 8,
     BLACK_ROOK = 9,
     BLACK_QUEEN = 10,
-    BLACK_KING = 11
+    BLACK_KING = 11,
+    NO_PIECE = 12 // Nothing on the square
 };
 
 /** Classic bitboard.
@@ -65,23 +69,134 @@ enum PieceLoc
 struct Bitboard
 {
     /** Constructors */
-    explicit Bitboard(uint64_t nvalue) : value(nvalue) {}
-    Bitboard() : value(0) {}
+    constexpr explicit Bitboard(uint64_t nvalue) : value(nvalue) {}
+    constexpr Bitboard() : value(0) {}
 
     /** Stored value of the bitboard */
     uint64_t value;
 
     /** Count all the bits in the bitboard */
-    [[nodiscard]] int getBitCount() const;
+    [[nodiscard]] constexpr int getBitCount() const
+    {
+        return std::popcount(value);
+    }
+
+    /** Get the lowest set square, 64 if the bitboard is empty */
+    [[nodiscard]] constexpr int getLsb() const
+    {
+        return std::countr_zero(value);
+    }
+
+    /** Get the highest set square, -1 if the bitboard is empty */
+    [[nodiscard]] constexpr int getMsb() const
+    {
+        return 63 - std::countl_zero(value);
+    }
+
+    /** Remove the lowest set square and return it, the bitboard must not be empty */
+    constexpr int popLsb()
+    {
+        const int square = getLsb();
+        value &= value - 1;
+        return square;
+    }
+
+    [[nodiscard]] constexpr bool isEmpty() const
+    {
+        return value == 0;
+    }
+
+    /** Iterates over the set squares from lowest to highest */
+    struct Iterator
+    {
+        uint64_t remaining;
+
+        constexpr int operator*() const
+        {
+            return std::countr_zero(remaining);
+        }
+
+        constexpr Iterator &operator++()
+        {
+            remaining &= remaining - 1;
+            return *this;
+        }
+
+        constexpr bool operator!=(const Iterator &other) const
+        {
+            return remaining != other.remaining;
+        }
+    };
+
+    /** Allows for (int square : bitboard) over every set square */
+    [[nodiscard]] constexpr Iterator begin() const
+    {
+        return {value};
+    }
+
+    [[nodiscard]] constexpr Iterator end() const
+    {
+        return {0};
+    }
 
     /** Assignment operator for simplicity */
-    Bitboard &operator=(const uint64_t &nvalue)
+    constexpr Bitboard &operator=(const uint64_t &nvalue)
     {
         value = nvalue;
         return *this;
     }
 };
 
+/** Remove the lowest set square of a raw bitboard and return it */
+constexpr int popLsb(uint64_t &bitboard)
+{
+    const int square = std::countr_zero(bitboard);
+    bitboard &= bitboard - 1;
+    return square;
+}
+
+/** Check and pin information for one side
+ *
+ * Generated once per position by Board::generateCheckInfo so that the legal moves of
+ * every piece are just its pseudo-legal moves masked with checkMask and its pin mask.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct CheckInfo
+{
+    /* Enemy pieces giving check to the king */
+    Bitboard checkers;
+
+    /* Squares a piece other than the king may move to. Every square when not in check,
+     * the checker and the squares between it and the king when in check once, and
+     * nothing when in double check */
+    Bitboard checkMask;
+
+    /* Rays from the king up to and including each pinning piece, split by direction */
+    Bitboard pinStraight;
+    Bitboard pinDiagonal;
+
+    /** Get the squares a piece on the square may move to without exposing the king
+     *
+     * @param square Square of the piece
+     * @return The pin ray the piece is on, or every square if it is not pinned
+     */
+    [[nodiscard]] constexpr uint64_t getPinMask(unsigned int square) const
+    {
+        if (pinStraight.value & (1ull << square))
+        {
+            return pinStraight.value;
+        }
+        if (pinDiagonal.value & (1ull << square))
+        {
+            return pinDiagonal.value;
+        }
+
+        return ~0ull;
+    }
+};
+
 struct Board
 {
     /* 64-bit representation of all locations of the pieces
@@ -92,6 +207,9 @@ struct Board
      */
     Bitboard data[12];
 
+    /* Piece standing on every square, NO_PIECE when empty. Kept in sync with data */
+    PieceLoc mailbox[64];
+
     /* Legal move generation information */
     bool genMoveInfo = false;
     Bitboard whiteAttacks;
@@ -99,17 +217,36 @@ struct Board
     Bitboard allPieces;
     Bitboard whitePieces;
     Bitboard blackPieces;
+    CheckInfo whiteCheckInfo;
+    CheckInfo blackCheckInfo;
 
     /* Methods */
+    Board();
+
     [[nodiscard]] Bitboard getTotalValue() const;
     void getTotalValue(Bitboard &total) const;
 
     void getWhitePieces(Bitboard &pieces) const;
     void getBlackPieces(Bitboard &pieces) const;
 
+    /** Get the piece standing on a square, NO_PIECE if the square is empty */
+    [[nodiscard]] PieceLoc getPieceAt(unsigned int square) const { return mailbox[square]; }
+    void clearMailbox();
+
     void moveMade();
     uint64_t getWhiteAttacks(Bitboard &whiteAttacks);
     uint64_t getBlackAttacks(Bitboard &blackAttacks);
+
+    template<SliderBackend Backend>
+    void generateCheckInfo(bool color);
+    template<SliderBackend Backend>
+    [[nodiscard]] uint64_t getAttackersTo(unsigned int square, uint64_t occupied) const;
+
+    /** Get the check and pin information of a side, true for white */
+    [[nodiscard]] const CheckInfo &getCheckInfo(bool color) const
+    {
+        return color ? whiteCheckInfo : blackCheckInfo;
+    }
 };
 
 } // namespace board
@@ -26,10 +26,14 @@
  *****************************************************************************/
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <string>
 
 #include "chess_engine/board/bitboard.h"
+#include "chess_engine/board/evaluation.h"
+#include "chess_engine/board/move.h"
+#include "chess_engine/board/nnue.h"
 
 namespace chessengine::board
 {
@@ -45,6 +49,33 @@ enum CastleRights
     BLACK_QUEENSIDE = 3
 };
 
+/* Castling rights are stored as a mask with one bit per CastleRights value */
+constexpr uint8_t NO_CASTLING_RIGHTS = 0;
+constexpr uint8_t ALL_CASTLING_RIGHTS = 0b1111;
+
+/** Generate the castling rights kept when a piece moves from or to each square
+ *
+ * Moving the king or a rook, or capturing a rook on its starting square, loses the rights using it.
+ *
+ * @return Masks to AND the castling rights with, indexed by square
+ */
+constexpr std::array<uint8_t, 64> generateCastlingMasks()
+{
+    std::array<uint8_t, 64> masks{};
+    masks.fill(ALL_CASTLING_RIGHTS);
+
+    masks[3] &= ~(1 << WHITE_KINGSIDE | 1 << WHITE_QUEENSIDE); // e1
+    masks[0] &= ~(1 << WHITE_KINGSIDE);                         // h1
+    masks[7] &= ~(1 << WHITE_QUEENSIDE);                        // a1
+    masks[59] &= ~(1 << BLACK_KINGSIDE | 1 << BLACK_QUEENSIDE); // e8
+    masks[56] &= ~(1 << BLACK_KINGSIDE);                        // h8
+    masks[63] &= ~(1 << BLACK_QUEENSIDE);                       // a8
+
+    return masks;
+}
+
+inline constexpr std::array<uint8_t, 64> CASTLING_MASKS = generateCastlingMasks();
+
 /** Board Representation
  *
  * This is a representation of a chess board using a combination of several methods.
@@ -60,17 +91,28 @@ struct ChessBoard
 
     /* Representing the castling rights
      *
-     * Represents the castling rights for each side
+     * One bit for each side, the bit index is the CastleRights value
      * Order represented is: White King
      *                       White Queen
      *                       Black King
      *                       Black Queen
      */
-    bool castlingRights[4] = {true, true, true, true};
+    uint8_t castlingRights = ALL_CASTLING_RIGHTS;
 
-    uint64_t enPassantSquare = 65; // No en passant square
+    uint8_t enPassantSquare = 65; // No en passant square
     bool whiteToMove = true;
 
+    /* Zobrist keys of the whole position, of only the pawns and of the number of each piece,
+     * kept up to date by makeMove */
+    uint64_t hashKey = 0;
+    uint64_t pawnKey = 0;
+    uint64_t materialKey = 0;
+
+    /* Material and piece-square score from white's point of view and the game phase,
+     * also kept up to date by makeMove */
+    Score psqtScore;
+    int phase = 0;
+
     // ---------------------------------- Methods ----------------------------------
 
     // Convenience methods
@@ -78,6 +120,16 @@ struct ChessBoard
     static std::string toAlgebraic(uint64_t square);
 
     [[nodiscard]] std::string getDisplayBoard() const;
+    template<SliderBackend Backend>
+    [[nodiscard]] uint64_t getEnPassantMove(bool color, unsigned square) const;
+
+    /** Check whether a castling right is still available */
+    [[nodiscard]] bool hasCastlingRight(CastleRights type) const { return castlingRights >> type & 1; }
+
+    void generateHashKeys();
+    void generateEvaluation();
+
+    PieceLoc makeMove(Move move, DirtyPieces &dirty);
 
     // Access and creation methods
     void createFromFEN(const std::string &fen, int *halfMoveClock = nullptr,
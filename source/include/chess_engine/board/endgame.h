@@ -0,0 +1,67 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * endgame.h - Specialized evaluation of known endgames
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace chessengine::board
+{
+
+struct ChessBoard;
+
+/* Score of a won endgame, well above any material balance and well below the mate scores */
+constexpr int KNOWN_WIN = 10000;
+
+/* Factors the endgame score is scaled by, out of SCALE_NORMAL */
+constexpr int SCALE_NORMAL = 64;
+constexpr int SCALE_DRAW = 0;
+
+/* Evaluates a whole position, in centipawns from the strong side's point of view */
+using EndgameFunction = int (*)(const ChessBoard &board, bool strongSide);
+
+/* Returns the factor the endgame score of the strong side is scaled by */
+using ScaleFunction = int (*)(const ChessBoard &board, bool strongSide);
+
+/** Endgame function of a material configuration, with the side it evaluates for */
+struct Endgame
+{
+    EndgameFunction evaluate;
+    bool strongSide;
+};
+
+[[nodiscard]] int evaluateKBNK(const ChessBoard &board, bool strongSide);
+[[nodiscard]] int evaluateKPK(const ChessBoard &board, bool strongSide);
+[[nodiscard]] int evaluateKRKP(const ChessBoard &board, bool strongSide);
+[[nodiscard]] int scaleOppositeBishops(const ChessBoard &board, bool strongSide);
+
+[[nodiscard]] bool probeKPK(unsigned strongKing, unsigned weakKing, unsigned pawn, bool strongToMove);
+
+[[nodiscard]] uint64_t computeMaterialKey(const std::string &pieces, bool strongSide) noexcept(false);
+[[nodiscard]] const Endgame *findEndgame(uint64_t materialKey);
+
+} // namespace chessengine::board
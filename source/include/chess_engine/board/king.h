@@ -26,6 +26,7 @@
  *****************************************************************************/
 #pragma once
 
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/piece.h"
 
 namespace chessengine
@@ -35,20 +36,54 @@ namespace board
 {
 
 /** King class
+ *
+ * The slider backend is unused, the enemy attacks are generated before the king moves.
  *
  * @author Matthew Brown
  * @date 05/28/2024
  */
-class King final : public Piece
+struct King
 {
-public:
-    King(bool color, ChessBoard *board, unsigned int location) : Piece(color, board, location) {}
-    ~King() override = default;
-
-    void makeMove(int to) override;
-    [[nodiscard]] char getType() const override;
-    void getAttacks(uint64_t &attacks) const override;
-    void getLegalMoves(uint64_t &moves) const override;
+    static constexpr PieceLoc WHITE_LOCATION = WHITE_KING;
+
+    /** Get the possible attacks for a king
+     *
+     * @param square Square of the king
+     * @return Squares the king attacks
+     */
+    template<bool Color, SliderBackend>
+    static constexpr uint64_t getAttacks(unsigned int square, uint64_t /* occupied */)
+    {
+        return KING_ATTACKS[square];
+    }
+
+    /** Get the legal moves for a king, not including castling
+     *
+     * @param board Board the king is on, the enemy attacks must be generated
+     * @param square Square of the king
+     * @return Squares the king may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square)
+    {
+        return getLegalMoves<Color, Backend>(board, square, ~getOwnPieces<Color>(board));
+    }
+
+    /** Get the legal moves for a king to a set of target squares
+     *
+     * Used to generate only part of the moves, e.g. only the captures, without filtering afterwards.
+     *
+     * @param board Board the king is on, the enemy attacks must be generated
+     * @param square Square of the king
+     * @param targets Squares the king may move to, must not contain own pieces
+     * @return Squares the king may move to
+     */
+    template<bool Color, SliderBackend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square, uint64_t targets)
+    {
+        const uint64_t enemyAttacks = (Color ? board.board.blackAttacks : board.board.whiteAttacks).value;
+        return KING_ATTACKS[square] & targets & ~enemyAttacks;
+    }
 };
 
 } // namespace board
@@ -26,6 +26,7 @@
  *****************************************************************************/
 #pragma once
 
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/piece.h"
 
 namespace chessengine
@@ -35,20 +36,62 @@ namespace board
 {
 
 /** Knight class
+ *
+ * Takes the slider backend like the sliders do so every piece is generated the same way,
+ * a knight never needs it.
  *
  * @author Matthew Brown
  * @date 05/28/2024
  */
-class Knight final : public Piece
+struct Knight
 {
-public:
-    Knight(bool color, ChessBoard *board, unsigned int location) : Piece(color, board, location) {}
-    ~Knight() override = default;
-
-    void makeMove(int to) override;
-    [[nodiscard]] char getType() const override;
-    void getAttacks(uint64_t &attacks) const override;
-    void getLegalMoves(uint64_t &moves) const override;
+    static constexpr PieceLoc WHITE_LOCATION = WHITE_KNIGHT;
+
+    /** Get the possible attacks for a knight
+     *
+     * @param square Square of the knight
+     * @return Squares the knight attacks
+     */
+    template<bool Color, SliderBackend>
+    static constexpr uint64_t getAttacks(unsigned int square, uint64_t /* occupied */)
+    {
+        return KNIGHT_ATTACKS[square];
+    }
+
+    /** Get the legal moves for a knight
+     *
+     * @param board Board the knight is on, its check information must be generated
+     * @param square Square of the knight
+     * @return Squares the knight may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square)
+    {
+        return getLegalMoves<Color, Backend>(board, square, ~getOwnPieces<Color>(board));
+    }
+
+    /** Get the legal moves for a knight to a set of target squares
+     *
+     * Used to generate only part of the moves, e.g. only the captures, without filtering afterwards.
+     *
+     * @param board Board the knight is on, its check information must be generated
+     * @param square Square of the knight
+     * @param targets Squares the knight may move to, must not contain own pieces
+     * @return Squares the knight may move to
+     */
+    template<bool Color, SliderBackend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square, uint64_t targets)
+    {
+        const CheckInfo &info = board.board.getCheckInfo(Color);
+
+        // A pinned knight can never stay on its pin ray
+        if ((info.pinStraight.value | info.pinDiagonal.value) & (1ull << square))
+        {
+            return 0;
+        }
+
+        return KNIGHT_ATTACKS[square] & targets & info.checkMask.value;
+    }
 };
 
 } // namespace board
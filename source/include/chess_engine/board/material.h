@@ -0,0 +1,100 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * material.h - Material configurations and their hash table
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "chess_engine/board/endgame.h"
+#include "chess_engine/board/evaluation.h"
+
+namespace chessengine::board
+{
+
+/* Imbalance scores: a bonus for the bishop pair, knights gain and rooks lose value with every pawn
+ * of their side above five */
+constexpr Score BISHOP_PAIR = {30, 50};
+constexpr Score KNIGHT_PAWN_ADJUSTMENT = {6, 6};
+constexpr Score ROOK_PAWN_ADJUSTMENT = {-12, -12};
+
+/** Everything about a material configuration, indexed by color where it matters
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct MaterialEntry
+{
+    uint64_t key = 0;
+    Score imbalance; // From white's point of view
+    int phase = 0;   // Clamped to MAX_PHASE
+
+    /* Replaces the whole evaluation when set */
+    EndgameFunction evaluationFunction = nullptr;
+    bool strongSide = true;
+
+    /* Scale the endgame score of the side that is ahead, the function wins over the factor when set */
+    ScaleFunction scaleFunctions[2]{};
+    uint8_t scaleFactors[2] = {SCALE_NORMAL, SCALE_NORMAL};
+};
+
+/** Hash table of material configurations, one per search thread
+ *
+ * Indexed by the material key of ChessBoard. Only a handful of configurations come up in a
+ * search, so entries are almost never recomputed.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class MaterialTable
+{
+    std::vector<MaterialEntry> m_entries;
+    uint64_t m_probes = 0;
+    uint64_t m_hits = 0;
+
+public:
+    static constexpr size_t DEFAULT_ENTRIES = 8192;
+
+    explicit MaterialTable(size_t entries = DEFAULT_ENTRIES);
+
+    const MaterialEntry &probe(const ChessBoard &board);
+    void clear();
+
+    [[nodiscard]] uint64_t getProbes() const
+    {
+        return m_probes;
+    }
+
+    [[nodiscard]] uint64_t getHits() const
+    {
+        return m_hits;
+    }
+};
+
+void computeMaterialEntry(const ChessBoard &board, MaterialEntry &entry);
+
+} // namespace chessengine::board
@@ -0,0 +1,223 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * move.h - Packed move type and fixed-capacity move list
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace chessengine::board
+{
+
+/** Flags stored in the top four bits of a move
+ *
+ * Bit 2 marks a capture and bit 3 marks a promotion, the low two bits of a promotion give the piece
+ * (knight, bishop, rook, queen) so it can be added straight onto WHITE_KNIGHT or BLACK_KNIGHT.
+ */
+enum MoveFlag : uint16_t
+{
+    QUIET = 0,
+    DOUBLE_PAWN_PUSH = 1,
+    KING_CASTLE = 2,
+    QUEEN_CASTLE = 3,
+    CAPTURE = 4,
+    EN_PASSANT = 5,
+    KNIGHT_PROMOTION = 8,
+    BISHOP_PROMOTION = 9,
+    ROOK_PROMOTION = 10,
+    QUEEN_PROMOTION = 11,
+    KNIGHT_PROMOTION_CAPTURE = 12,
+    BISHOP_PROMOTION_CAPTURE = 13,
+    ROOK_PROMOTION_CAPTURE = 14,
+    QUEEN_PROMOTION_CAPTURE = 15
+};
+
+/** A move packed into 16 bits
+ *
+ * Bits 0-5 hold the starting square, bits 6-11 the target square and bits 12-15 the MoveFlag.
+ * Castling is stored as the king's move.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class Move
+{
+    uint16_t m_value;
+
+public:
+    /** Leaves the move uninitialized so move lists don't pay to clear themselves */
+    Move() = default;
+    constexpr Move(unsigned from, unsigned to, unsigned flags = QUIET) :
+        m_value(static_cast<uint16_t>(from | to << 6 | flags << 12))
+    {
+    }
+
+    /** Rebuild a move from getValue */
+    static constexpr Move fromValue(uint16_t value)
+    {
+        Move move;
+        move.m_value = value;
+        return move;
+    }
+
+    [[nodiscard]] constexpr unsigned getFrom() const
+    {
+        return m_value & 0x3f;
+    }
+
+    [[nodiscard]] constexpr unsigned getTo() const
+    {
+        return m_value >> 6 & 0x3f;
+    }
+
+    [[nodiscard]] constexpr unsigned getFlags() const
+    {
+        return m_value >> 12;
+    }
+
+    [[nodiscard]] constexpr uint16_t getValue() const
+    {
+        return m_value;
+    }
+
+    [[nodiscard]] constexpr bool isCapture() const
+    {
+        return getFlags() & CAPTURE;
+    }
+
+    [[nodiscard]] constexpr bool isPromotion() const
+    {
+        return getFlags() & KNIGHT_PROMOTION;
+    }
+
+    [[nodiscard]] constexpr bool isCastle() const
+    {
+        return getFlags() == KING_CASTLE or getFlags() == QUEEN_CASTLE;
+    }
+
+    /** Offset of the promoted piece from the knight, only valid for promotions */
+    [[nodiscard]] constexpr unsigned getPromotionOffset() const
+    {
+        return getFlags() & 3;
+    }
+
+    [[nodiscard]] std::string toString() const;
+
+    constexpr bool operator==(const Move &other) const = default;
+};
+
+/* Null move, never generated since a piece can't move to its own square */
+constexpr Move NO_MOVE = Move(0, 0);
+
+/* More than the maximum number of legal moves in any reachable position */
+constexpr unsigned MAX_MOVES = 256;
+
+/* Deepest ply a search can reach */
+constexpr int MAX_PLY = 128;
+
+/** Get the rook's starting and ending squares for a castling move
+ *
+ * @param move Castling move of the king
+ * @return Bitboard with both rook squares set
+ */
+constexpr uint64_t getCastlingRookMove(Move move)
+{
+    const unsigned king = move.getFrom();
+    return move.getFlags() == KING_CASTLE ? (1ull << (king - 3) | 1ull << (king - 1))
+                                          : (1ull << (king + 4) | 1ull << (king + 1));
+}
+
+/** List of moves stored on the stack
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class MoveList
+{
+    std::array<Move, MAX_MOVES> m_moves;
+    unsigned m_size = 0;
+
+public:
+    void add(Move move)
+    {
+        m_moves[m_size++] = move;
+    }
+
+    void add(unsigned from, unsigned to, unsigned flags = QUIET)
+    {
+        m_moves[m_size++] = Move(from, to, flags);
+    }
+
+    void clear()
+    {
+        m_size = 0;
+    }
+
+    [[nodiscard]] unsigned getSize() const
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] bool isEmpty() const
+    {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] bool contains(Move move) const;
+
+    Move &operator[](unsigned index)
+    {
+        return m_moves[index];
+    }
+
+    const Move &operator[](unsigned index) const
+    {
+        return m_moves[index];
+    }
+
+    Move *begin()
+    {
+        return m_moves.data();
+    }
+
+    Move *end()
+    {
+        return m_moves.data() + m_size;
+    }
+
+    [[nodiscard]] const Move *begin() const
+    {
+        return m_moves.data();
+    }
+
+    [[nodiscard]] const Move *end() const
+    {
+        return m_moves.data() + m_size;
+    }
+};
+
+} // namespace chessengine::board
@@ -0,0 +1,151 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * nnue.h - HalfKP neural network evaluation
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "chess_engine/board/bitboard.h"
+#include "chess_engine/board/nnue_kernels.h"
+
+namespace chessengine::board
+{
+
+struct ChessBoard;
+
+/* Network shape, HalfKP features into two accumulators then two hidden layers. NNUE_L1 is in nnue_kernels.h */
+constexpr unsigned NNUE_FEATURES = 64 * 10 * 64; // King square, piece other than a king, square
+constexpr unsigned NNUE_L2 = 32;
+constexpr unsigned NNUE_L3 = 32;
+
+/* Quantization, hidden layer outputs are shifted down by this many bits and the output divided by NNUE_OUTPUT_SCALE */
+constexpr int NNUE_WEIGHT_SHIFT = 6;
+constexpr int NNUE_OUTPUT_SCALE = 16;
+
+/* Network scores are clamped to stay clear of mate scores */
+constexpr int NNUE_MAX_SCORE = 10000;
+
+/* Network file layout, a 64 byte header followed by the sections below, each starting on a 64 byte boundary:
+ *   int16 feature biases[NNUE_L1], int16 feature weights[NNUE_FEATURES][NNUE_L1]
+ *   int32 hidden 1 biases[NNUE_L2], int8 hidden 1 weights[NNUE_L2][2 * NNUE_L1]
+ *   int32 hidden 2 biases[NNUE_L3], int8 hidden 2 weights[NNUE_L3][NNUE_L2]
+ *   int32 output bias, int8 output weights[NNUE_L3]
+ * The header starts with NNUE_MAGIC and NNUE_VERSION, every value is little endian. */
+constexpr char NNUE_MAGIC[8] = {'C', 'E', 'N', 'N', 'U', 'E', '\0', '\0'};
+constexpr uint32_t NNUE_VERSION = 1;
+
+/** Running sums of the first layer, one per perspective
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct alignas(64) Accumulator
+{
+    int16_t values[2][NNUE_L1]; // Indexed by color, WHITE is 1
+
+    bool operator==(const Accumulator &other) const = default;
+};
+
+/** Pieces a move added to or removed from the board, collected by ChessBoard::makeMove
+ *
+ * A piece moving from one square to another shows up once with both squares, a piece that appears
+ * only has a to square and one that disappears only a from square. 64 means no square.
+ */
+struct DirtyPieces
+{
+    static constexpr unsigned MAX_DIRTY = 3;
+
+    unsigned count = 0;
+    PieceLoc pieces[MAX_DIRTY];
+    uint8_t from[MAX_DIRTY];
+    uint8_t to[MAX_DIRTY];
+
+    void add(PieceLoc piece, unsigned fromSquare, unsigned toSquare)
+    {
+        pieces[count] = piece;
+        from[count] = static_cast<uint8_t>(fromSquare);
+        to[count] = static_cast<uint8_t>(toSquare);
+        ++count;
+    }
+};
+
+[[nodiscard]] std::vector<const NnueKernels *> getAvailableNnueKernels();
+[[nodiscard]] const NnueKernels &getNnueKernels();
+void setNnueKernels(const std::string &name) noexcept(false);
+
+/** HalfKP network
+ *
+ * The weights are memory mapped straight from the network file, nothing is copied, so
+ * every search thread and game shares one read-only set of weights. Each position keeps
+ * an Accumulator with the first layer for both perspectives, ChessGame updates it from the
+ * pieces every move changes and only recomputes a perspective from scratch when its king moves.
+ *
+ * Features are relative to the perspective: the squares of a black perspective are flipped
+ * vertically and the pieces of the perspective's own color come first.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class Network
+{
+    void *m_mapping = nullptr;
+    size_t m_size = 0;
+
+    const int16_t *m_featureBiases = nullptr;
+    const int16_t *m_featureWeights = nullptr;
+    const int32_t *m_hidden1Biases = nullptr;
+    const int8_t *m_hidden1Weights = nullptr;
+    const int32_t *m_hidden2Biases = nullptr;
+    const int8_t *m_hidden2Weights = nullptr;
+    const int32_t *m_outputBias = nullptr;
+    const int8_t *m_outputWeights = nullptr;
+
+    void unmap();
+
+public:
+    Network() = default;
+    explicit Network(const std::string &path) noexcept(false) { load(path); }
+    ~Network();
+
+    Network(const Network &) = delete;
+    Network &operator=(const Network &) = delete;
+
+    void load(const std::string &path) noexcept(false);
+    [[nodiscard]] bool isLoaded() const { return m_mapping != nullptr; }
+
+    void refresh(const ChessBoard &board, bool perspective, Accumulator &accumulator) const;
+    void update(const ChessBoard &board, const DirtyPieces &dirty, const Accumulator &parent,
+                Accumulator &child) const;
+    [[nodiscard]] int evaluate(const Accumulator &accumulator, bool whiteToMove) const;
+
+    static void writeRandom(const std::string &path, uint64_t seed) noexcept(false);
+    [[nodiscard]] static size_t getFileSize();
+};
+
+} // namespace chessengine::board
@@ -0,0 +1,70 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * nnue_kernels.h - SIMD kernels of the neural network evaluation
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+/* Only fixed-width types in here, this header is compiled with different instruction sets */
+#include <cstdint>
+
+namespace chessengine::board
+{
+
+/* Accumulator size per perspective, every kernel handles rows of this many values */
+constexpr unsigned NNUE_L1 = 256;
+
+/** Kernels the network runs on, one set per instruction set
+ *
+ * Input sizes of affine are multiples of 32, the inputs are clipped to [0, 127] and the weights
+ * to [-127, 127] so pairs of products never saturate 16 bits.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct NnueKernels
+{
+    const char *name;
+
+    /* Add or subtract a row of NNUE_L1 feature weights */
+    void (*addRow)(int16_t *accumulator, const int16_t *row);
+    void (*subRow)(int16_t *accumulator, const int16_t *row);
+
+    /* Clamp to [0, 127], size is a multiple of 32 */
+    void (*clippedRelu)(const int16_t *input, uint8_t *output, unsigned size);
+
+    /* output[j] = biases[j] + dot(input, weights row j) */
+    void (*affine)(const uint8_t *input, unsigned inputSize, const int8_t *weights, const int32_t *biases,
+                   int32_t *output, unsigned outputSize);
+};
+
+extern const NnueKernels SCALAR_KERNELS;
+
+#ifdef CHESS_ENGINE_NNUE_X86
+extern const NnueKernels SSE41_KERNELS;
+extern const NnueKernels AVX2_KERNELS;
+extern const NnueKernels AVX512_KERNELS;
+#endif
+
+} // namespace chessengine::board
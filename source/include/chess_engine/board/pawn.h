@@ -26,6 +26,7 @@
  *****************************************************************************/
 #pragma once
 
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/piece.h"
 
 namespace chessengine
@@ -35,52 +36,105 @@ namespace board
 {
 
 /** Pawn class
+ *
+ * White pawns move up the board and black pawns move down it, the color template
+ * parameter picks the direction at compile time. The slider backend is only needed to
+find an en passant capture that would expose the king.
  *
  * @author Matthew Brown
  * @date 05/28/2024
  */
-class Pawn : public Piece
+struct Pawn
 {
-public:
-    Pawn(bool color, ChessBoard *board, unsigned int location) : Piece(color, board, location) {}
+    static constexpr PieceLoc WHITE_LOCATION = WHITE_PAWN;
 
-    void makeMove(int to) override;
-    [[nodiscard]] char getType() const override { return PieceType::PAWN; }
-};
+    /** Get the possible attacks for a pawn
+     *
+     * @param square Square of the pawn
+     * @return Squares the pawn attacks
+     */
+    template<bool Color, SliderBackend>
+    static constexpr uint64_t getAttacks(unsigned int square, uint64_t /* occupied */)
+    {
+        return getPawnAttacks(Color, square);
+    }
 
-/** White pawn class
- *
- * @author Matthew Brown
- * @date 06/7/2024
- *
- */
-class WhitePawn : public Pawn
-{
-public:
-    WhitePawn(ChessBoard *board, unsigned int location) : Pawn(true, board, location) {}
-    ~WhitePawn() override = default;
-
-    void getAttacks(uint64_t &attacks) const override;
-    void getLegalMoves(uint64_t &moves) const override;
-    void getAllMoves(uint64_t &moves) const;
-    void getForwardMoves(uint64_t &moves) const;
-};
+    /** Get the single and double pushes of a pawn
+     *
+     * @param square Square of the pawn
+     * @param occupied Every occupied square
+     * @return Squares the pawn can push to
+     */
+    template<bool Color>
+    static constexpr uint64_t getForwardMoves(unsigned int square, uint64_t occupied)
+    {
+        if (square > 55 or square < 8)
+        {
+            return 0; // Invalid location
+        }
 
-/** Black pawn class
- *
- * @author Matthew Brown
- * @date 06/7/2024
- */
-class BlackPawn : public Pawn
-{
-public:
-    BlackPawn(ChessBoard *board, unsigned int location) : Pawn(false, board, location) {}
-    ~BlackPawn() override = default;
-
-    void getAttacks(uint64_t &attacks) const override;
-    void getLegalMoves(uint64_t &moves) const override;
-    void getAllMoves(uint64_t &moves) const;
-    void getForwardMoves(uint64_t &moves) const;
+        const unsigned int single = Color ? square + 8 : square - 8;
+        if (occupied & (1ull << single))
+        {
+            return 0;
+        }
+
+        // Double square move from the second rank
+        const bool onStartRank = Color ? square < 16 : square >= 48;
+        const unsigned int twice = Color ? square + 16 : square - 16;
+        if (onStartRank and !(occupied & (1ull << twice)))
+        {
+            return 1ull << single | 1ull << twice;
+        }
+
+        return 1ull << single;
+    }
+
+    /** Get the legal moves for a pawn, including en passant
+     *
+     * @param board Board the pawn is on, its check information must be generated
+     * @param square Square of the pawn
+     * @return Squares the pawn may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square)
+    {
+        return getLegalMoves<Color, Backend>(board, square, ~getOwnPieces<Color>(board));
+    }
+
+    /** Get the legal moves for a pawn to a set of target squares
+     *
+     * Used to generate only part of the moves, e.g. only the captures, without filtering afterwards.
+     *
+     * @param board Board the pawn is on, its check information must be generated
+     * @param square Square of the pawn
+     * @param targets Squares the pawn may move to, must not contain own pieces. En passant is always included
+     * @return Squares the pawn may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square, uint64_t targets)
+    {
+        const CheckInfo &info = board.board.getCheckInfo(Color);
+
+        uint64_t pushes = getForwardMoves<Color>(square, board.board.allPieces.value);
+        uint64_t captures = getPawnAttacks(Color, square) & getEnemyPieces<Color>(board);
+
+        // A pinned pawn may only move along its pin
+        if (info.pinStraight.value & (1ull << square))
+        {
+            captures = 0;
+            pushes &= info.pinStraight.value;
+        }
+        else if (info.pinDiagonal.value & (1ull << square))
+        {
+            pushes = 0;
+            captures &= info.pinDiagonal.value;
+        }
+
+        // En passant is always a capture, its target square is empty so it can't be in the targets
+        return ((pushes | captures) & targets & info.checkMask.value) |
+               board.getEnPassantMove<Backend>(Color, square);
+    }
 };
 
 } // namespace board
@@ -0,0 +1,102 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * pawn_structure.h - Pawn structure evaluation and its hash table
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "chess_engine/board/evaluation.h"
+
+namespace chessengine::board
+{
+
+/* Pawn structure scores, in centipawns for one pawn */
+constexpr Score DOUBLED_PAWN = {-11, -28};
+constexpr Score ISOLATED_PAWN = {-9, -14};
+constexpr Score BACKWARD_PAWN = {-7, -11};
+
+/* Bonus of a passed pawn by its rank, counted from its own side */
+constexpr Score PASSED_PAWN[8] = {{0, 0}, {3, 12}, {8, 18}, {12, 30}, {28, 52}, {52, 96}, {84, 148}, {0, 0}};
+
+/* Bonus of a pawn in front of its king, one and two ranks ahead, on the king's or a neighbouring file */
+constexpr Score PAWN_SHIELD[2] = {{14, 0}, {7, 0}};
+
+/** Everything about a pawn structure that only changes when pawns move, indexed by color where it matters
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct PawnEntry
+{
+    uint64_t key = 0;
+    Score score;                 // Every pawn structure term from white's point of view
+    uint64_t passedPawns[2]{};   // Pawns no enemy pawn can stop
+    uint64_t attackSpans[2]{};   // Squares the pawns attack now or after pushing
+
+    /* The shield depends on the king square too, it is kept for the last king square seen */
+    uint8_t kingSquares[2] = {64, 64};
+    Score shields[2];
+};
+
+/** Hash table of pawn structures, one per search thread
+ *
+ * Indexed by the pawn key of ChessBoard. Pawns rarely move so almost every probe hits and the
+ * pawn terms cost next to nothing. An empty entry is the entry of a board without pawns.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class PawnTable
+{
+    std::vector<PawnEntry> m_entries;
+    uint64_t m_probes = 0;
+    uint64_t m_hits = 0;
+
+public:
+    static constexpr size_t DEFAULT_ENTRIES = 16384;
+
+    explicit PawnTable(size_t entries = DEFAULT_ENTRIES);
+
+    PawnEntry &probe(const ChessBoard &board);
+    void clear();
+
+    [[nodiscard]] uint64_t getProbes() const
+    {
+        return m_probes;
+    }
+
+    [[nodiscard]] uint64_t getHits() const
+    {
+        return m_hits;
+    }
+};
+
+void computePawnEntry(const ChessBoard &board, PawnEntry &entry);
+[[nodiscard]] Score evaluatePawns(const ChessBoard &board, PawnTable &pawnTable);
+
+} // namespace chessengine::board
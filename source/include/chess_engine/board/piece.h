@@ -52,87 +52,93 @@ enum PieceType
 };
 
 /** Representation of a chess piece
+ *
+ * A small value made from the bitboards when it is asked for, the board stays the only
+ * owner of where the pieces are. The move generation of each type lives in the static
+ * members of Pawn, Knight, Bishop, Rook, Queen and King, templated on the color so the
+ * move generator picks them at compile time.
  *
  * @author Matthew Brown
  * @date 05/27/2024
  */
 class Piece
 {
-protected:
-    uint64_t m_location;
-    /* Boolean representation of the color of the piece, true for white, false for black */
-    bool m_color;
-
-    ChessBoard *m_board;
-
-    /* References to the white and black kings */
-    Piece *m_blackKing = nullptr;
-    Piece *m_whiteKing = nullptr;
+    const ChessBoard *m_board = nullptr;
+    unsigned int m_location = 65;
+    PieceLoc m_piece = NO_PIECE;
 
 public:
-    /** Constructor */
-    Piece(bool color, ChessBoard *board, uint64_t location) :
-        m_location(location), m_color(color), m_board(board)
+    /** Constructors */
+    constexpr Piece() = default;
+    constexpr Piece(PieceLoc piece, const ChessBoard *board, unsigned int location) :
+        m_board(board), m_location(location), m_piece(piece)
     {
     }
 
-    /** Destructor */
-    virtual ~Piece() = default;
-
     // Getters
     /** Get the represented color of the piece */
-    [[nodiscard]] bool getColor() const
+    [[nodiscard]] constexpr bool getColor() const
     {
-        return m_color;
+        return m_piece < BLACK_PAWN;
     }
 
     /** Get the referenced boards that the piece is on */
-    [[nodiscard]] ChessBoard *getBoard() const
+    [[nodiscard]] constexpr const ChessBoard *getBoard() const
     {
         return m_board;
     }
 
     /** Get the current location of the piece */
-    [[nodiscard]] uint64_t getSquare() const
+    [[nodiscard]] constexpr uint64_t getSquare() const
     {
         return m_location;
     }
 
-    /** Get the current reference to the white/black king */
-    [[nodiscard]] Piece *getKing(int color) const
+    /** Get the index of the piece's bitboard in Board::data */
+    [[nodiscard]] constexpr PieceLoc getPieceLoc() const
     {
-        return color ? m_whiteKing : m_blackKing;
+        return m_piece;
     }
 
     /** Return if the piece is valid */
-    [[nodiscard]] bool isValid() const
+    [[nodiscard]] constexpr bool isValid() const
     {
-        return m_location < 65;
+        return m_piece != NO_PIECE and m_location < 64;
     }
 
-    void setKing(Piece *king)
-    {
-        if (king == nullptr)
-            return;
-
-        king->getColor() ? m_whiteKing = king : m_blackKing = king;
-    }
-
-    // Virtual methods
-    /** Make a move on the board, to be overridden for special behavior */
-    virtual void makeMove(int to)
+    /** Get the type of the piece */
+    [[nodiscard]] constexpr char getType() const
     {
-        m_location = to;
+        constexpr PieceType types[6] = {PAWN, KNIGHT, BISHOP, ROOK, QUEEN, KING};
+        return isValid() ? types[m_piece % 6] : 0;
     }
 
-    /** Get the type of the piece */
-    [[nodiscard]] virtual char getType() const = 0;
     /** Retrieve all possible attacks for the piece */
-    virtual void getAttacks(uint64_t &attacks) const = 0;
+    void getAttacks(uint64_t &attacks) const;
     /** Retrieve all possible legal moves for the piece */
-    virtual void getLegalMoves(uint64_t &moves) const = 0;
+    void getLegalMoves(uint64_t &moves) const;
 };
 
-} // namespace chessengine::board
+/** Get the pieces of one side
+ *
+ * @param board Board to read from
+ * @return Every square holding a piece of the side
+ */
+template<bool Color>
+constexpr uint64_t getOwnPieces(const ChessBoard &board)
+{
+    return (Color ? board.board.whitePieces : board.board.blackPieces).value;
+}
 
+/** Get the pieces of the other side
+ *
+ * @param board Board to read from
+ * @return Every square holding a piece of the other side
+ */
+template<bool Color>
+constexpr uint64_t getEnemyPieces(const ChessBoard &board)
+{
+    return (Color ? board.board.blackPieces : board.board.whitePieces).value;
+}
 
+} // namespace chessengine::board
@@ -26,6 +26,7 @@
  *****************************************************************************/
 #pragma once
 
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/piece.h"
 
 namespace chessengine
@@ -35,26 +36,72 @@ namespace board
 {
 
 /** Queen class
+ *
+ * Uses the rook and bishop lookups of the slider backend it is instantiated for.
  *
  * @author Matthew Brown
  * @date 05/28/2024
  */
-class Queen final : public Piece
+struct Queen
 {
-public:
-    Queen(bool color, ChessBoard *board, unsigned int location) : Piece(color, board, location) {}
-    ~Queen() override = default;
-
-    void makeMove(int to) override;
-    [[nodiscard]] char getType() const override;
-    void getAttacks(uint64_t &attacks) const override;
-    void getLegalMoves(uint64_t &moves) const override;
-
-    void getLeftRightMoves(uint64_t &moves) const;
-    void getBottomTopMoves(uint64_t &moves) const;
-    void getBottomLeftTopRightMoves(uint64_t &moves) const;
-    void getBottomRightTopLeftMoves(uint64_t &moves) const;
-    void getAllMoves(uint64_t &moves) const;
+    static constexpr PieceLoc WHITE_LOCATION = WHITE_QUEEN;
+
+    /** Get the possible attacks for a queen
+     *
+     * @param square Square of the queen
+     * @param occupied Every occupied square
+     * @return Squares the queen attacks
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getAttacks(unsigned int square, uint64_t occupied)
+    {
+        return getQueenAttacks<Backend>(square, occupied);
+    }
+
+    /** Get the legal moves for a queen
+     *
+     * @param board Board the queen is on, its check information must be generated
+     * @param square Square of the queen
+     * @return Squares the queen may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square)
+    {
+        return getLegalMoves<Color, Backend>(board, square, ~getOwnPieces<Color>(board));
+    }
+
+    /** Get the legal moves for a queen to a set of target squares
+     *
+     * Used to generate only part of the moves, e.g. only the captures, without filtering afterwards.
+     *
+     * @param board Board the queen is on, its check information must be generated
+     * @param square Square of the queen
+     * @param targets Squares the queen may move to, must not contain own pieces
+     * @return Squares the queen may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square, uint64_t targets)
+    {
+        const CheckInfo &info = board.board.getCheckInfo(Color);
+        const uint64_t occupied = board.board.allPieces.value;
+
+        // A pinned queen only keeps the moves along its pin
+        uint64_t attacks;
+        if (info.pinStraight.value & (1ull << square))
+        {
+            attacks = getRookAttacks<Backend>(square, occupied) & info.pinStraight.value;
+        }
+        else if (info.pinDiagonal.value & (1ull << square))
+        {
+            attacks = getBishopAttacks<Backend>(square, occupied) & info.pinDiagonal.value;
+        }
+        else
+        {
+            attacks = getQueenAttacks<Backend>(square, occupied);
+        }
+
+        return attacks & targets & info.checkMask.value;
+    }
 };
 
 } // namespace board
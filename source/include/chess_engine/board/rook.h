@@ -26,6 +26,7 @@
  *****************************************************************************/
 #pragma once
 
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/piece.h"
 
 namespace chessengine
@@ -35,23 +36,63 @@ namespace board
 {
 
 /** Rook class
+ *
+ * The slider backend must be the one the attack tables were built for, see withSliderBackend.
  *
  * @author Matthew Brown
  * @date 05/28/2024
  */
-class Rook final : public Piece
+struct Rook
 {
-public:
-    Rook(bool color, ChessBoard *board, unsigned int location) : Piece(color, board, location) {}
-    ~Rook() override = default;
+    static constexpr PieceLoc WHITE_LOCATION = WHITE_ROOK;
+
+    /** Get the possible attacks for a rook
+     *
+     * @param square Square of the rook
+     * @param occupied Every occupied square
+     * @return Squares the rook attacks
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getAttacks(unsigned int square, uint64_t occupied)
+    {
+        return getRookAttacks<Backend>(square, occupied);
+    }
+
+    /** Get the legal moves for a rook
+     *
+     * @param board Board the rook is on, its check information must be generated
+     * @param square Square of the rook
+     * @return Squares the rook may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square)
+    {
+        return getLegalMoves<Color, Backend>(board, square, ~getOwnPieces<Color>(board));
+    }
+
+    /** Get the legal moves for a rook to a set of target squares
+     *
+     * Used to generate only part of the moves, e.g. only the captures, without filtering afterwards.
+     *
+     * @param board Board the rook is on, its check information must be generated
+     * @param square Square of the rook
+     * @param targets Squares the rook may move to, must not contain own pieces
+     * @return Squares the rook may move to
+     */
+    template<bool Color, SliderBackend Backend>
+    static uint64_t getLegalMoves(const ChessBoard &board, unsigned int square, uint64_t targets)
+    {
+        const CheckInfo &info = board.board.getCheckInfo(Color);
 
-    void makeMove(int to) override;
-    [[nodiscard]] char getType() const override;
-    void getAttacks(uint64_t &attacks) const override;
-    void getLegalMoves(uint64_t &moves) const override;
+        // Pinned along a diagonal, the rook can't stay on the pin ray
+        if (info.pinDiagonal.value & (1ull << square))
+        {
+            return 0;
+        }
 
-    void getLeftRightMoves(uint64_t &moves) const;
-    void getBottomTopMoves(uint64_t &moves) const;
+        return getRookAttacks<Backend>(square, board.board.allPieces.value) & targets &
+               info.checkMask.value & info.getPinMask(square);
+    }
 };
 
 } // namespace board
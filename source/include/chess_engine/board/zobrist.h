@@ -0,0 +1,123 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * zobrist.h - Zobrist keys for hashing positions
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace chessengine::board
+{
+
+/** Generate a list of pseudo random keys with splitmix64
+ *
+ * Evaluated at compile time, so every build hashes positions the same way.
+ *
+ * @param seed Starting state of the generator
+ * @return The keys
+ */
+template<std::size_t N>
+consteval std::array<uint64_t, N> generateZobristKeys(uint64_t seed)
+{
+    std::array<uint64_t, N> keys{};
+
+    for (auto &key: keys)
+    {
+        seed += 0x9e3779b97f4a7c15ull;
+        uint64_t value = seed;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+        key = value ^ (value >> 31);
+    }
+
+    return keys;
+}
+
+/* One key per piece type and square, indexed by PieceLoc * 64 + square */
+inline constexpr std::array<uint64_t, 12 * 64> ZOBRIST_PIECES = generateZobristKeys<12 * 64>(0x5a0b1e5);
+
+/** Generate one key per castling rights mask
+ *
+ * Each right gets a random key and the key of a mask is the XOR of the keys of its rights,
+ * so a move changing the rights only needs the old and the new mask.
+ *
+ * @return Keys indexed by ChessBoard::castlingRights
+ */
+constexpr std::array<uint64_t, 16> generateCastlingKeys()
+{
+    const std::array<uint64_t, 4> rights = generateZobristKeys<4>(0xca571e);
+
+    std::array<uint64_t, 16> keys{};
+    for (unsigned mask = 0; mask < 16; ++mask)
+    {
+        for (unsigned right = 0; right < 4; ++right)
+        {
+            if (mask & 1u << right)
+            {
+                keys[mask] ^= rights[right];
+            }
+        }
+    }
+
+    return keys;
+}
+
+/* One key per castling rights mask, indexed by ChessBoard::castlingRights */
+inline constexpr std::array<uint64_t, 16> ZOBRIST_CASTLING = generateCastlingKeys();
+
+/* One key per file of the en passant square */
+inline constexpr std::array<uint64_t, 8> ZOBRIST_EN_PASSANT = generateZobristKeys<8>(0xe1a55a);
+
+/* Added when black is to move */
+inline constexpr uint64_t ZOBRIST_BLACK_TO_MOVE = generateZobristKeys<1>(0xb1ac)[0];
+
+/* One key per piece type and count, indexed by PieceLoc * 16 + count. A board with n pieces of a type
+ * has the keys of counts 0 to n - 1 in its material key */
+inline constexpr std::array<uint64_t, 12 * 16> ZOBRIST_MATERIAL = generateZobristKeys<12 * 16>(0x3a7e71a1);
+
+/** Get the key of a piece standing on a square
+ *
+ * @param piece PieceLoc of the piece
+ * @param square Square the piece is on
+ * @return Key to XOR into the hash
+ */
+constexpr uint64_t getPieceKey(unsigned int piece, unsigned int square)
+{
+    return ZOBRIST_PIECES[piece * 64 + square];
+}
+
+/** Get the material key of the nth piece of a type
+ *
+ * @param piece PieceLoc of the piece
+ * @param count Number of pieces of the type before it was added
+ * @return Key to XOR into the material key
+ */
+constexpr uint64_t getMaterialKey(unsigned int piece, unsigned int count)
+{
+    return ZOBRIST_MATERIAL[piece * 16 + count];
+}
+
+} // namespace chessengine::board
@@ -20,12 +20,84 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  *
- * chess_engine.h - <Brief description>
+ * chess_engine.h - The engine that searches the games
  * @author Matthew Brown
  * @date 05/27/2024
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "chess_engine/chess_game.h"
+#include "chess_engine/search.h"
+#include "chess_engine/transposition_table.h"
+
 namespace chessengine
 {
-}
+
+/** Chess Engine
+ *
+ * Owns everything a search shares between positions and threads.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class ChessEngine
+{
+    TranspositionTable m_transpositionTable;
+    std::atomic<bool> m_stop = false;
+    unsigned m_threadCount = 1;
+    SearchOptions m_searchOptions;
+    std::unique_ptr<board::Network> m_network;
+
+    /* Runs the searches started with startSearch */
+    std::jthread m_searchThread;
+
+    SearchResult runSearch(const ChessGame &game, const SearchLimits &limits, const SearchCallback &onIteration);
+
+public:
+    explicit ChessEngine(size_t hashMegabytes = 16) : m_transpositionTable(hashMegabytes) {}
+    ~ChessEngine();
+
+    ChessEngine(const ChessEngine &) = delete;
+    ChessEngine &operator=(const ChessEngine &) = delete;
+
+    void setHashSize(size_t megabytes);
+    void setThreadCount(unsigned threads);
+    void setSearchOptions(const SearchOptions &options);
+    void loadNetwork(const std::string &path) noexcept(false);
+    void newGame();
+
+    SearchResult search(const ChessGame &game, const SearchLimits &limits, const SearchCallback &onIteration = {});
+    void startSearch(const ChessGame &game, const SearchLimits &limits, SearchCallback onIteration,
+                     std::function<void(const SearchResult &)> onFinish);
+    void stop();
+    void wait();
+
+    [[nodiscard]] unsigned getThreadCount() const
+    {
+        return m_threadCount;
+    }
+
+    [[nodiscard]] const SearchOptions &getSearchOptions() const
+    {
+        return m_searchOptions;
+    }
+
+    [[nodiscard]] bool hasNetwork() const
+    {
+        return m_network != nullptr;
+    }
+
+    [[nodiscard]] TranspositionTable &getTranspositionTable()
+    {
+        return m_transpositionTable;
+    }
+};
+
+} // namespace chessengine
@@ -30,12 +30,41 @@
 #include <vector>
 
 #include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/move.h"
+#include "chess_engine/board/nnue.h"
 #include "chess_engine/board/piece.h"
 #include "simplelogger.hpp"
 
 namespace chessengine
 {
 
+/** Everything needed to take back a move that can't be recovered from the move itself
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct MoveUndo
+{
+    uint64_t hashKey;
+    uint64_t pawnKey;
+    uint64_t materialKey;
+    board::Score psqtScore;
+    int phase;
+    board::Move move;
+    uint8_t captured; // PieceLoc of the captured piece, NO_PIECE if nothing was captured
+    uint8_t enPassantSquare;
+    uint8_t castlingRights;
+    int halfMoveClock;
+};
+
+/* Which part of the legal moves to generate */
+enum GenType : uint8_t
+{
+    GEN_ALL,
+    GEN_CAPTURES, // Captures, en passant and every promotion
+    GEN_QUIETS,   // Every other move, including castling
+};
+
 /** Chess Game
  *
  * This class represents a chess game.
@@ -46,24 +75,32 @@ namespace chessengine
  */
 class ChessGame
 {
-    /* Stored information on all pieces */
-    std::vector<board::Piece *> m_pieceInformation;
-
-    board::Piece *m_whiteKing = nullptr;
-    board::Piece *m_blackKing = nullptr;
-
     /* Game information */
     int m_halfMoveClock = 0; // This keeps track of the 50 move rule
     int m_fullMoveClock = 0;
 
-    // std::vector<ChessMove> m_moveHistory;
+    std::vector<MoveUndo> m_moveHistory;
 
     board::ChessBoard m_board;
 
+    /* Network used by evaluate, not owned, and the accumulator of every position since it was set */
+    const board::Network *m_network = nullptr;
+    std::vector<board::Accumulator> m_accumulators;
+
+    void refreshAccumulator();
+
+    /* The slider backend is picked once by the public entry points and passed down */
+    template<bool Color, board::SliderBackend Backend>
+    void generateMoveInfo();
+    template<bool Color, GenType Type, board::SliderBackend Backend>
+    void generateMoves(board::MoveList &moves);
+    template<bool Color, board::SliderBackend Backend>
+    bool isLegal(board::Move move);
+
 public:
     [[nodiscard]] uint64_t getPieceCount() const;
-    [[nodiscard]] std::vector<board::Piece *> getPieces() const;
-    [[nodiscard]] board::Piece *getPiece(uint64_t square) const;
+    [[nodiscard]] std::vector<board::Piece> getPieces() const;
+    [[nodiscard]] board::Piece getPiece(uint64_t square) const;
 
     void pregenLegalMoves();
     void generateWhiteAttacks();
@@ -72,15 +109,43 @@ public:
     bool canCastle(board::CastleRights type);
     void canCastle(bool color, board::Bitboard &castling);
 
+    void generateLegalMoves(board::MoveList &moves);
+    void generateCaptures(board::MoveList &moves);
+    void generateQuiets(board::MoveList &moves);
+    [[nodiscard]] bool isLegal(board::Move move);
+
+    void makeMove(board::Move move);
+    void unmakeMove();
+    void makeNullMove();
+    void unmakeNullMove();
+    void reservePlies(int plies);
+
+    [[nodiscard]] bool isInCheck() const;
+    [[nodiscard]] bool isRepetition() const;
+    [[nodiscard]] bool isDraw() const;
+
     // Getters
-    [[nodiscard]] board::Piece *getWhiteKing() const;
-    [[nodiscard]] board::Piece *getBlackKing() const;
+    [[nodiscard]] board::Piece getWhiteKing() const;
+    [[nodiscard]] board::Piece getBlackKing() const;
 
     void resetGame();
 
     void createFromFEN(const std::string &fen) noexcept(false);
     [[nodiscard]] std::string getFEN() const;
 
+    void setNetwork(const board::Network *network);
+    [[nodiscard]] int evaluate(board::PawnTable *pawnTable = nullptr, board::MaterialTable *materialTable = nullptr) const;
+
+    [[nodiscard]] const board::Network *getNetwork() const
+    {
+        return m_network;
+    }
+
+    [[nodiscard]] const board::Accumulator &getAccumulator() const
+    {
+        return m_accumulators.back();
+    }
+
     [[nodiscard]] int getHalfMoveClock() const
     {
         return m_halfMoveClock;
@@ -91,12 +156,30 @@ public:
         return m_fullMoveClock;
     }
 
+    [[nodiscard]] uint64_t getHashKey() const
+    {
+        return m_board.hashKey;
+    }
+
+    [[nodiscard]] uint64_t getPawnKey() const
+    {
+        return m_board.pawnKey;
+    }
+
+    [[nodiscard]] uint64_t getMaterialKey() const
+    {
+        return m_board.materialKey;
+    }
+
     [[nodiscard]] board::ChessBoard *getBoard()
     {
         return &m_board;
     }
 
-    ~ChessGame();
+    [[nodiscard]] const board::ChessBoard *getBoard() const
+    {
+        return &m_board;
+    }
 };
 
 } // namespace chessengine
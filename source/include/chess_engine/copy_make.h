@@ -0,0 +1,103 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * copy_make.h - Copy-make stack of positions
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <vector>
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/move.h"
+#include "chess_engine/board/nnue.h"
+#include "chess_engine/chess_game.h"
+
+namespace chessengine
+{
+
+/** Copy-make alternative to ChessGame make/unmake
+ *
+ * Every ply has a preallocated slot. Making a move copies the board of the current ply into the
+ * next slot and makes the move there with ChessBoard::makeMove, the same code ChessGame uses, so
+ * the child carries the same state: bitboards, mailbox, castling and en passant, hash keys,
+ * running evaluation, clocks and, with a network, the accumulator. Taking a move back only
+ * steps back a ply, the parent was never touched.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class CopyMakeStack
+{
+    /* Slot of one ply, cache line aligned. The board fills five lines and the clocks start a sixth */
+    struct alignas(64) Frame
+    {
+        board::ChessBoard board;
+        int halfMoveClock = 0;
+        int fullMoveClock = 0;
+    };
+
+    std::vector<Frame> m_frames;
+    std::vector<board::Accumulator> m_accumulators;
+    const board::Network *m_network = nullptr;
+    int m_ply = 0;
+
+public:
+    explicit CopyMakeStack(const ChessGame &game);
+
+    void makeMove(board::Move move);
+
+    /** Take back the last move, the parent position is still in its slot */
+    void unmakeMove()
+    {
+        SL_ASSERT_TRUE(m_ply > 0, "Error: No move to take back");
+        --m_ply;
+    }
+
+    [[nodiscard]] const board::ChessBoard &getBoard() const
+    {
+        return m_frames[m_ply].board;
+    }
+
+    [[nodiscard]] const board::Accumulator &getAccumulator() const
+    {
+        return m_accumulators[m_ply];
+    }
+
+    [[nodiscard]] int getHalfMoveClock() const
+    {
+        return m_frames[m_ply].halfMoveClock;
+    }
+
+    [[nodiscard]] int getFullMoveClock() const
+    {
+        return m_frames[m_ply].fullMoveClock;
+    }
+
+    [[nodiscard]] int getPly() const
+    {
+        return m_ply;
+    }
+};
+
+} // namespace chessengine
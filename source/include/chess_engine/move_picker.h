@@ -0,0 +1,128 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * move_picker.h - Staged move picker for the search
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <cstdint>
+
+#include "chess_engine/board/move.h"
+#include "chess_engine/chess_game.h"
+
+namespace chessengine
+{
+
+/* History scores stay within [-MAX_HISTORY, MAX_HISTORY] */
+constexpr int MAX_HISTORY = 16384;
+
+/** Butterfly history table
+ *
+ * Scores quiet moves by their from and to squares, moves that caused beta cutoffs are raised
+ * and the quiet moves searched before them are lowered. Every update pulls the score towards
+ * the bonus so old results fade out and the scores never overflow.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class HistoryTable
+{
+    int16_t m_table[2][64][64]{};
+
+public:
+    void clear();
+    void update(bool color, board::Move move, int bonus);
+
+    [[nodiscard]] int get(bool color, board::Move move) const
+    {
+        return m_table[color][move.getFrom()][move.getTo()];
+    }
+};
+
+/** Staged move picker
+ *
+ * Hands out the moves of a position one at a time, generating each group only when the ones
+ * before it are used up. Most beta cutoffs happen on the move from the transposition table or
+ * a good capture, and then the quiet moves are never generated or scored at all.
+ *
+ * The stages are, in order:
+ * - The move from the transposition table, checked for legality instead of generated
+ * - Captures and promotions that don't lose material, most valuable victim and least valuable attacker first
+ * - The two killer moves of the ply, quiet moves that caused a cutoff in a sibling node
+ * - The other quiet moves, best history score first
+ * - Captures that lose material in the exchange
+ *
+ * Every legal move is returned exactly once. The quiescence picker only has the good captures.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class MovePicker
+{
+public:
+    enum Stage : uint8_t
+    {
+        TT_MOVE,
+        GENERATE_CAPTURES,
+        GOOD_CAPTURES,
+        KILLERS,
+        GENERATE_QUIETS,
+        QUIETS,
+        BAD_CAPTURES,
+        DONE
+    };
+
+private:
+    ChessGame &m_game;
+    const HistoryTable *m_history = nullptr;
+    board::Move m_ttMove = board::NO_MOVE;
+    board::Move m_killers[2] = {board::NO_MOVE, board::NO_MOVE};
+
+    Stage m_stage = TT_MOVE;
+    bool m_capturesOnly = false;
+    unsigned m_killerIndex = 0;
+    unsigned m_current = 0;
+    unsigned m_badCaptures = 0; // Losing captures are moved to the front of the capture list
+
+    board::MoveList m_captures;
+    board::MoveList m_quiets;
+    int m_scores[board::MAX_MOVES];
+
+    void scoreCaptures();
+    void scoreQuiets();
+    board::Move pickBest(board::MoveList &moves);
+
+public:
+    MovePicker(ChessGame &game, board::Move ttMove, const board::Move *killers, const HistoryTable &history);
+    explicit MovePicker(ChessGame &game);
+
+    board::Move nextMove();
+
+    [[nodiscard]] Stage getStage() const
+    {
+        return m_stage;
+    }
+};
+
+} // namespace chessengine
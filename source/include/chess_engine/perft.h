@@ -0,0 +1,88 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * perft.h - Move generation node counting
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "chess_engine/board/move.h"
+#include "chess_engine/chess_game.h"
+
+namespace chessengine
+{
+
+/** Result of a perft run
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct PerftResult
+{
+    uint64_t nodes = 0;
+    std::chrono::nanoseconds time{0};
+
+    /* Nodes below each root move, only filled in when dividing */
+    std::vector<std::pair<board::Move, uint64_t>> divide;
+
+    [[nodiscard]] uint64_t getNodesPerSecond() const;
+    [[nodiscard]] std::string toString() const;
+};
+
+/** Lockless table of subtree node counts shared by the perft threads
+ *
+ * Works like the search's transposition table: an entry is the key XORed with the data next to the
+ * data, so a torn entry fails to verify and is counted again rather than corrupting the total.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class PerftHashTable
+{
+    struct Entry
+    {
+        uint64_t key; // Zobrist key XOR data
+        uint64_t data; // Node count in the low 56 bits, depth in the top 8
+    };
+
+    std::vector<Entry> m_entries;
+
+public:
+    explicit PerftHashTable(size_t megabytes);
+
+    [[nodiscard]] bool probe(uint64_t key, int depth, uint64_t &nodes) const;
+    void store(uint64_t key, int depth, uint64_t nodes);
+};
+
+uint64_t perft(ChessGame &game, int depth);
+uint64_t perft(ChessGame &game, int depth, PerftHashTable &hashTable);
+PerftResult runPerft(ChessGame &game, int depth, bool divide = false);
+PerftResult runParallelPerft(const ChessGame &game, int depth, unsigned threads, size_t hashMegabytes = 0);
+
+} // namespace chessengine
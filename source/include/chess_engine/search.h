@@ -0,0 +1,206 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * search.h - Alpha-beta search with iterative deepening
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "chess_engine/board/material.h"
+#include "chess_engine/board/move.h"
+#include "chess_engine/board/pawn_structure.h"
+#include "chess_engine/chess_game.h"
+#include "chess_engine/move_picker.h"
+#include "chess_engine/transposition_table.h"
+
+namespace chessengine
+{
+
+/* Scores are in centipawns from the side to move's point of view */
+constexpr int DRAW_SCORE = 0;
+constexpr int MATE_SCORE = 32000;
+constexpr int INFINITE_SCORE = 32001;
+
+/* Any score beyond this is a forced mate found within the search */
+constexpr int MATE_IN_MAX_PLY = MATE_SCORE - board::MAX_PLY;
+
+/** When a search has to stop, zero means no limit
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct SearchLimits
+{
+    int depth = board::MAX_PLY - 1;
+    std::chrono::milliseconds moveTime{0}; // Stops the search once passed, zero for no limit
+    std::chrono::milliseconds softTime{0}; // No new iteration is started after it
+    uint64_t nodes = 0;
+    int mate = 0; // Stops once a mate in this many moves is found
+
+    /* Only these root moves are searched when not empty */
+    std::vector<board::Move> searchMoves;
+
+    /* While this is set the time limits are ignored, the search is pondering on the opponent's time */
+    const std::atomic<bool> *pondering = nullptr;
+
+    [[nodiscard]] bool isPondering() const
+    {
+        return pondering != nullptr and pondering->load(std::memory_order_relaxed);
+    }
+};
+
+/** Selective search techniques, each can be turned off to measure what it saves
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct SearchOptions
+{
+    bool nullMovePruning = true;
+    bool lateMoveReductions = true;
+    bool reverseFutilityPruning = true;
+    bool futilityPruning = true;
+    bool checkExtensions = true;
+};
+
+/** What a search found after finishing an iteration
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct SearchInfo
+{
+    int depth = 0;
+    int selDepth = 0; // Deepest ply reached, quiescence included
+    int score = 0;
+    uint64_t nodes = 0;
+    int hashfull = 0; // Permille of the transposition table in use
+    std::chrono::nanoseconds time{0};
+    std::vector<board::Move> pv;
+
+    [[nodiscard]] uint64_t getNodesPerSecond() const;
+    [[nodiscard]] std::string toString() const;
+};
+
+/** Result of a whole search, the best move comes from the last finished iteration
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+struct SearchResult
+{
+    board::Move bestMove = board::NO_MOVE;
+    SearchInfo info;
+};
+
+/* Called after every finished iteration */
+using SearchCallback = std::function<void(const SearchInfo &)>;
+
+/** Negamax alpha-beta search
+ *
+ * Searches with iterative deepening and principal variation search, using the shared
+ * transposition table for move ordering and cutoffs. Moves are handed out by a staged
+ * MovePicker, ordered with killer moves and a history table. The principal variation of every
+ * iteration is collected in a triangular PV table.
+ *
+ * Outside the principal variation the tree is pruned with null moves, reverse futility and
+ * futility pruning, and late quiet moves are searched to a reduced depth first. Checks are
+ * extended by a ply. SearchOptions turns each of these on or off.
+ *
+ * Several searches of the same position can run at once for Lazy SMP. Each has its own game
+ * and tables and they only share the transposition table and the stop flag. Thread 0 is the
+ * main thread, it alone watches the limits. The helpers skip some depths so they
+ * fill the table with different parts of the tree.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class Search
+{
+    ChessGame m_game;
+    TranspositionTable &m_transpositionTable;
+    std::atomic<bool> &m_stop;
+    unsigned m_threadId;
+    SearchOptions m_options;
+
+    SearchLimits m_limits;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::steady_clock::time_point m_clockStart; // The time limits count from here, ponderhit moves it up
+    std::atomic<uint64_t> m_nodes = 0; // Only written by the searching thread, read by the others
+    int m_selDepth = 0;
+
+    /* Triangular PV table, row ply holds the best line found from that ply */
+    board::Move m_pvTable[board::MAX_PLY][board::MAX_PLY]{};
+    int m_pvLength[board::MAX_PLY]{};
+
+    /* Move ordering, killers are the last two quiet moves that caused a cutoff at each ply */
+    board::Move m_killers[board::MAX_PLY][2]{};
+    HistoryTable m_history;
+    board::PawnTable m_pawnTable;
+    board::MaterialTable m_materialTable;
+
+    int evaluate();
+    int negamax(int alpha, int beta, int depth, int ply);
+    int quiescence(int alpha, int beta, int ply);
+    void countNode();
+    void updateQuietMoves(int ply, int depth, board::Move bestMove, const board::Move *quiets, int quietCount);
+    void updatePv(int ply, board::Move move);
+    [[nodiscard]] bool shouldStop();
+    [[nodiscard]] std::chrono::nanoseconds getClockTime();
+    [[nodiscard]] bool isDepthSkipped(int depth) const;
+
+public:
+    Search(const ChessGame &game, TranspositionTable &transpositionTable, std::atomic<bool> &stop,
+           unsigned threadId = 0, const SearchOptions &options = {});
+
+    SearchResult run(const SearchLimits &limits, const SearchCallback &onIteration = {});
+
+    [[nodiscard]] uint64_t getNodes() const
+    {
+        return m_nodes.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const board::PawnTable &getPawnTable() const
+    {
+        return m_pawnTable;
+    }
+
+    [[nodiscard]] const board::MaterialTable &getMaterialTable() const
+    {
+        return m_materialTable;
+    }
+
+    [[nodiscard]] bool isMainThread() const
+    {
+        return m_threadId == 0;
+    }
+};
+
+} // namespace chessengine
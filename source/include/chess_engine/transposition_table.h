@@ -0,0 +1,128 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * transposition_table.h - Shared lockless transposition table
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "chess_engine/board/move.h"
+
+namespace chessengine
+{
+
+/** What a stored score says about the real score of the position */
+enum Bound : uint8_t
+{
+    BOUND_NONE = 0,  // Empty entry
+    BOUND_UPPER = 1, // Failed low, the real score is at most the stored score
+    BOUND_LOWER = 2, // Failed high, the real score is at least the stored score
+    BOUND_EXACT = 3
+};
+
+/** Unpacked contents of a transposition table entry */
+struct TTData
+{
+    board::Move move;
+    int score;
+    int eval;
+    int depth;
+    Bound bound;
+};
+
+/** Transposition table shared by every search thread
+ *
+ * Entries are two 64-bit words, the packed data and the key XORed with the data. Threads read and
+ * write the words without any locking, an entry torn by two threads writing at once no longer
+ * XORs back to its key and is treated as a miss. Four entries make up a 64-byte cluster so a probe
+ * only touches one cache line.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class TranspositionTable
+{
+    struct Entry
+    {
+        uint64_t key; // Zobrist key XOR data
+        uint64_t data;
+    };
+
+    struct alignas(64) Cluster
+    {
+        Entry entries[4];
+    };
+
+    static_assert(sizeof(Cluster) == 64);
+
+    Cluster *m_clusters = nullptr;
+    size_t m_clusterCount = 0;
+    size_t m_bytes = 0;
+    uint8_t m_generation = 0;
+
+    [[nodiscard]] Cluster &getCluster(uint64_t key) const
+    {
+        return m_clusters[key & (m_clusterCount - 1)];
+    }
+
+    void release();
+
+public:
+    explicit TranspositionTable(size_t megabytes = 16);
+    ~TranspositionTable();
+
+    TranspositionTable(const TranspositionTable &) = delete;
+    TranspositionTable &operator=(const TranspositionTable &) = delete;
+
+    void resize(size_t megabytes, bool hugePages = true) noexcept(false);
+    void clear();
+    void newSearch();
+
+    [[nodiscard]] bool probe(uint64_t key, TTData &data) const;
+    void store(uint64_t key, board::Move move, int score, int eval, int depth, Bound bound);
+
+    /** Start loading the cluster of a position before it is probed */
+    void prefetch(uint64_t key) const
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(&getCluster(key));
+#endif
+    }
+
+    [[nodiscard]] int getHashfull() const;
+
+    [[nodiscard]] size_t getSize() const
+    {
+        return m_bytes;
+    }
+
+    [[nodiscard]] size_t getEntryCount() const
+    {
+        return m_clusterCount * 4;
+    }
+};
+
+} // namespace chessengine
@@ -0,0 +1,90 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * uci.h - Universal Chess Interface front end
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iosfwd>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include "chess_engine/chess_engine.h"
+#include "chess_engine/chess_game.h"
+#include "chess_engine/search.h"
+
+namespace chessengine
+{
+
+/** Talks the Universal Chess Interface protocol with a GUI
+ *
+ * Commands are read on the calling thread while searches run on the engine's search thread, so
+ * stop, ponderhit and isready are answered while a search is running. Everything is written to a
+ * single stream under a mutex, the search thread writes the info and bestmove lines itself.
+ *
+ * @author Matthew Brown
+ * @date 10/17/2026
+ */
+class Uci
+{
+    std::ostream &m_output;
+    std::mutex m_outputMutex;
+
+    ChessEngine m_engine;
+    ChessGame m_game;
+
+    /* Read by the search while pondering, cleared by ponderhit */
+    std::atomic<bool> m_pondering = false;
+
+    /* After an infinite or ponder search ends on its own bestmove waits for stop or ponderhit */
+    std::mutex m_bestMoveMutex;
+    std::condition_variable m_bestMoveCondition;
+    bool m_holdBestMove = false;
+    bool m_infinite = false;
+
+    std::chrono::milliseconds m_moveOverhead{30};
+
+    void send(const std::string &line);
+    void releaseBestMove();
+
+    void handleUci();
+    void handleSetOption(std::istringstream &stream);
+    void handlePosition(std::istringstream &stream);
+    void handleGo(std::istringstream &stream);
+    void handleStop();
+    void handlePonderHit();
+
+public:
+    explicit Uci(std::ostream &output);
+
+    bool handleCommand(const std::string &line);
+    void run(std::istream &input);
+    void wait();
+};
+
+} // namespace chessengine
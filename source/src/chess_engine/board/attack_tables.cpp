@@ -0,0 +1,332 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * attack_tables.cpp - Generation of the attack tables
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/attack_tables.h"
+
+#include <bit>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+using namespace chessengine::board;
+
+Magic chessengine::board::rookMagics[64];
+Magic chessengine::board::bishopMagics[64];
+bool chessengine::board::usePext = false;
+uint64_t chessengine::board::squaresBetween[64][64];
+
+namespace
+{
+
+/* Magic numbers for the board layout used here (square 0 is h1), every magic
+ * indexes its square with exactly popcount(mask) bits */
+constexpr uint64_t ROOK_MAGIC_NUMBERS[64] = {
+        0x1080004008801020ull, 0x0840092002c03000ull, 0x1900200010400900ull, 0x0880100008000480ull,
+        0x4200100420080200ull, 0x8100020100080400ull, 0x0200040110886200ull, 0x0200008040220411ull,
+        0x0404800084400220ull, 0x0000401000402000ull, 0x0086001081220440ull, 0x0408800800100280ull,
+        0x000a001201040820ull, 0x8848800200840080ull, 0x4001000100040200ull, 0x0442000102105084ull,
+        0x9080010020804100ull, 0x0040404000201009ull, 0x0000808010002009ull, 0x2200090021d00100ull,
+        0x0008008008040080ull, 0x0004004002010040ull, 0x0011040008015042ull, 0x00000a0001768104ull,
+        0x0000800080204009ull, 0x2010004140002001ull, 0x9800200280100080ull, 0x1000100080080080ull,
+        0x0442000a00049020ull, 0x2100040080020080ull, 0x0800120400900148ull, 0x0010040a00128541ull,
+        0x2800804000800030ull, 0x1010002000400041ull, 0x4000200011004100ull, 0x0610008410800800ull,
+        0x0400802402800800ull, 0xc100020080800400ull, 0x0002000802000401ull, 0x0182085882000401ull,
+        0x0220204000808000ull, 0x2860100040024022ull, 0x0001002004110040ull, 0x99101042000a0020ull,
+        0x0004080004008080ull, 0x0010040002008080ull, 0x2012004881020004ull, 0x8300842444820011ull,
+        0x0088403882010200ull, 0x0820400080210100ull, 0x0110910040a00300ull, 0x0801100280080480ull,
+        0x0242009008200600ull, 0x1002000489500200ull, 0x0040800200010080ull, 0x0091800041000080ull,
+        0x0000209300488001ull, 0x04c1002414824001ull, 0x020020000b001041ull, 0x7000100004200901ull,
+        0x8002002004100802ull, 0x30010002084c0007ull, 0x0888221800813004ull, 0x4000002840840112ull,
+};
+
+constexpr uint64_t BISHOP_MAGIC_NUMBERS[64] = {
+        0xa010041108003100ull, 0x006082020a002900ull, 0x6810010619200000ull, 0x08281a0520000408ull,
+        0x0001104001000400ull, 0x0018901008048400ull, 0x00040a0210245280ull, 0x000200210808a402ull,
+        0x9140048410821200ull, 0x0800091010820041ull, 0x20504804832202c0ull, 0x0100091401081000ull,
+        0x8021011140000012ull, 0x0810020804450400ull, 0x208b0542109008a2ull, 0x0080084a08040204ull,
+        0x0040e2a80811244cull, 0x2505022008008108ull, 0x0430220100420040ull, 0x010a040420220040ull,
+        0x1105000290400000ull, 0x0093001200822120ull, 0x4000a62048043004ull, 0x280120048a015004ull,
+        0x006090002a020814ull, 0x44042000240800d0ull, 0x01102800040a4400ull, 0x1004080080220040ull,
+        0x0001001011004024ull, 0x0010044000805040ull, 0x0914041200820100ull, 0x0004821012821480ull,
+        0x0024040500c05021ull, 0x0088611002080200ull, 0x0116080a00040020ull, 0x4000020080080080ull,
+        0x2450450140840040ull, 0x0000880201484100ull, 0x0222020404020092ull, 0x8081110600002e00ull,
+        0x2842101105000801ull, 0x1100809008001025ull, 0x00020202221c0400ull, 0x0422014022009020ull,
+        0x0210046102100c00ull, 0xc004008082029102ull, 0x00aa461801101200ull, 0x0404080080201108ull,
+        0x020542108c205002ull, 0x0410544804100100ull, 0x0040910841100000ull, 0x0400200042021100ull,
+        0x00004204850400c0ull, 0x0200100410a42102ull, 0x1040020801210102ull, 0x0805040410420000ull,
+        0x2884804130100200ull, 0x800c262201242000ull, 0x1058000194108800ull, 0x0014221054420204ull,
+        0x0104000012a02200ull, 0x0200881003300100ull, 0x0140400202840100ull, 0x0402020801010201ull,
+};
+
+/* Directions as (rank, column) steps */
+constexpr int ROOK_DIRECTIONS[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+constexpr int BISHOP_DIRECTIONS[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+/* Every rook uses at most 12 bits and every bishop at most 9 bits, the exact sizes are
+ * the sum of 2^popcount(mask) over all the squares */
+constexpr unsigned int ROOK_TABLE_SIZE = 102400;
+constexpr unsigned int BISHOP_TABLE_SIZE = 5248;
+
+/* Shared attacks table for both sliders */
+uint64_t attackTable[ROOK_TABLE_SIZE + BISHOP_TABLE_SIZE];
+
+/** Walk the rays of a slider until they hit a piece or the edge of the board
+ *
+ * Only used to fill the tables, the lookups replace this everywhere else.
+ *
+ * @param square Square of the slider
+ * @param occupied Pieces on the board
+ * @param directions Directions the slider moves in
+ * @return All squares attacked by the slider
+ */
+uint64_t getSlidingAttacks(unsigned int square, uint64_t occupied, const int (&directions)[4][2])
+{
+    uint64_t attacks = 0;
+
+    for (const auto &direction: directions)
+    {
+        int rank = static_cast<int>(square / 8) + direction[0];
+        int column = static_cast<int>(square % 8) + direction[1];
+
+        while (rank >= 0 and rank < 8 and column >= 0 and column < 8)
+        {
+            attacks |= 1ull << (rank * 8 + column);
+
+            if (occupied & (1ull << (rank * 8 + column)))
+            {
+                break;
+            }
+
+            rank += direction[0];
+            column += direction[1];
+        }
+    }
+
+    return attacks;
+}
+
+/** Fill the magic information and attacks for one type of slider
+ *
+ * @param magics Magic information to fill
+ * @param numbers Magic numbers of the slider
+ * @param directions Directions the slider moves in
+ * @param table Start of the slider's attacks in the shared table
+ */
+void initSlider(Magic (&magics)[64], const uint64_t (&numbers)[64], const int (&directions)[4][2], uint64_t *table)
+{
+    constexpr uint64_t RANK_1 = 0xffull;
+    constexpr uint64_t RANK_8 = RANK_1 << 56;
+    constexpr uint64_t COLUMN_H = 0x0101010101010101ull;
+    constexpr uint64_t COLUMN_A = COLUMN_H << 7;
+
+    for (unsigned int square = 0; square < 64; ++square)
+    {
+        // Pieces on the edge of the board never block anything
+        const uint64_t edges = ((RANK_1 | RANK_8) & ~(RANK_1 << (square / 8 * 8))) |
+                               ((COLUMN_H | COLUMN_A) & ~(COLUMN_H << (square % 8)));
+
+        Magic &magic = magics[square];
+        magic.mask = getSlidingAttacks(square, 0, directions) & ~edges;
+        magic.magic = numbers[square];
+        magic.shift = 64 - std::popcount(magic.mask);
+        magic.attacks = table;
+
+        // Go through every subset of the mask (Carry-Rippler)
+        uint64_t occupied = 0;
+        do
+        {
+            const unsigned int index = usePext ? magic.getIndex<SliderBackend::PEXT>(occupied)
+                                               : magic.getIndex<SliderBackend::MAGIC>(occupied);
+            magic.attacks[index] = getSlidingAttacks(square, occupied, directions);
+            occupied = (occupied - magic.mask) & magic.mask;
+        }
+        while (occupied);
+
+        table += 1ull << std::popcount(magic.mask);
+    }
+}
+
+/** Fill the table of squares between every pair of squares */
+void initSquaresBetween()
+{
+    for (unsigned int from = 0; from < 64; ++from)
+    {
+        for (unsigned int to = 0; to < 64; ++to)
+        {
+            const uint64_t fromBit = 1ull << from;
+            const uint64_t toBit = 1ull << to;
+
+            if (getSlidingAttacks(from, 0, ROOK_DIRECTIONS) & toBit)
+            {
+                squaresBetween[from][to] = getSlidingAttacks(from, toBit, ROOK_DIRECTIONS) &
+                                           getSlidingAttacks(to, fromBit, ROOK_DIRECTIONS);
+            }
+            else if (getSlidingAttacks(from, 0, BISHOP_DIRECTIONS) & toBit)
+            {
+                squaresBetween[from][to] = getSlidingAttacks(from, toBit, BISHOP_DIRECTIONS) &
+                                           getSlidingAttacks(to, fromBit, BISHOP_DIRECTIONS);
+            }
+        }
+    }
+}
+
+/** Run the cpuid instruction
+ *
+ * @param leaf Leaf to query
+ * @param registers Results in the order eax, ebx, ecx, edx
+ * @return False if cpuid is not available
+ */
+bool getCpuid(unsigned int leaf, unsigned int (&registers)[4])
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int values[4];
+    __cpuidex(values, static_cast<int>(leaf), 0);
+    for (int i = 0; i < 4; ++i)
+    {
+        registers[i] = static_cast<unsigned int>(values[i]);
+    }
+    return true;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    return __get_cpuid_count(leaf, 0, &registers[0], &registers[1], &registers[2], &registers[3]);
+#else
+    return false;
+#endif
+}
+
+/** Check if PEXT is implemented in hardware at full speed
+ *
+ * AMD processors before Zen 3 (family 19h) run PEXT in microcode, which is much slower
+ * than the magic multiplication, so they keep the magic backend by default.
+ */
+bool isPextFast()
+{
+    unsigned int registers[4];
+    if (!getCpuid(0, registers))
+    {
+        return false;
+    }
+
+    // Vendor string is stored in ebx, edx, ecx
+    const bool amd = registers[1] == 0x68747541 and registers[3] == 0x69746e65 and registers[2] == 0x444d4163;
+    if (!amd)
+    {
+        return true;
+    }
+
+    getCpuid(1, registers);
+    unsigned int family = (registers[0] >> 8) & 0xf;
+    if (family == 0xf)
+    {
+        family += (registers[0] >> 20) & 0xff;
+    }
+
+    return family >= 0x19;
+}
+
+/* Build the tables once at startup */
+struct AttackTableInitializer
+{
+    AttackTableInitializer()
+    {
+        initAttackTables();
+    }
+} attackTableInitializer;
+
+} // namespace
+
+/** Build the slider attack tables
+ *
+ * This is done automatically when the program starts, calling it again does nothing.
+ */
+void chessengine::board::initAttackTables()
+{
+    static bool initialized = false;
+    if (initialized)
+    {
+        return;
+    }
+
+    usePext = isPextSupported() and isPextFast();
+
+    initSlider(rookMagics, ROOK_MAGIC_NUMBERS, ROOK_DIRECTIONS, attackTable);
+    initSlider(bishopMagics, BISHOP_MAGIC_NUMBERS, BISHOP_DIRECTIONS, attackTable + ROOK_TABLE_SIZE);
+    initSquaresBetween();
+
+    initialized = true;
+}
+
+/** Check if the CPU supports the BMI2 PEXT instruction
+ *
+ * @return True if the PEXT backend can be used
+ */
+bool chessengine::board::isPextSupported()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    unsigned int registers[4];
+    if (!getCpuid(0, registers) or registers[0] < 7)
+    {
+        return false;
+    }
+
+    // Leaf 7, ebx bit 8 is BMI2
+    getCpuid(7, registers);
+    return registers[1] & (1u << 8);
+#else
+    return false;
+#endif
+}
+
+/** Get the backend currently used for slider lookups */
+SliderBackend chessengine::board::getSliderBackend()
+{
+    return usePext ? SliderBackend::PEXT : SliderBackend::MAGIC;
+}
+
+/** Switch the backend used for slider lookups
+ *
+ * The table is rebuilt in the order of the new backend, so this must not be called
+ * while anything else is generating moves.
+ *
+ * @param backend Backend to use
+ * @return False if the backend is not supported by this CPU, the current one is kept
+ */
+bool chessengine::board::setSliderBackend(SliderBackend backend)
+{
+    if (backend == SliderBackend::PEXT and !isPextSupported())
+    {
+        return false;
+    }
+
+    usePext = backend == SliderBackend::PEXT;
+
+    initSlider(rookMagics, ROOK_MAGIC_NUMBERS, ROOK_DIRECTIONS, attackTable);
+    initSlider(bishopMagics, BISHOP_MAGIC_NUMBERS, BISHOP_DIRECTIONS, attackTable + ROOK_TABLE_SIZE);
+
+    return true;
+}
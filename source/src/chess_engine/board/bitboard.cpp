@@ -25,21 +25,15 @@
  * @date 05/28/2024
  *****************************************************************************/
 #include "chess_engine/board/bitboard.h"
+#include "chess_engine/board/attack_tables.h"
+
+#include <algorithm>
+#include <iterator>
 
 using namespace chessengine::board;
 
-int Bitboard::getBitCount() const
-{
-    int count = 0;
-    for (uint64_t i = 0; i < 64; ++i)
-    {
-        if (value & (0b1ull << i))
-        {
-            ++count;
-        }
-    }
-    return count;
-}
+/** Create an empty board */
+Board::Board() { clearMailbox(); }
 
 Bitboard Board::getTotalValue() const
 {
@@ -71,5 +65,112 @@ void Board::getBlackPieces(Bitboard &pieces) const
     pieces.value = data[6].value | data[7].value | data[8].value | data[9].value | data[10].value | data[11].value;
 }
 
+/** Mark every square of the mailbox as empty */
+void Board::clearMailbox() { std::fill(std::begin(mailbox), std::end(mailbox), NO_PIECE); }
+
 /* To be worked on in the future */
 void Board::moveMade() { genMoveInfo = false; }
+
+/** Get every piece of either color attacking a square
+ *
+ * @param square Square to look at
+ * @param occupied Occupied squares the sliders are blocked by, pieces missing from it are ignored
+ * @return Bitboard of the attackers
+ */
+template<SliderBackend Backend>
+uint64_t Board::getAttackersTo(unsigned int square, uint64_t occupied) const
+{
+    const uint64_t straight = data[WHITE_ROOK].value | data[WHITE_QUEEN].value | data[BLACK_ROOK].value |
+                              data[BLACK_QUEEN].value;
+    const uint64_t diagonal = data[WHITE_BISHOP].value | data[WHITE_QUEEN].value | data[BLACK_BISHOP].value |
+                              data[BLACK_QUEEN].value;
+
+    // A white pawn attacks the square if a black pawn on the square would attack the white pawn
+    const uint64_t attackers = (getPawnAttacks(false, square) & data[WHITE_PAWN].value) |
+                               (getPawnAttacks(true, square) & data[BLACK_PAWN].value) |
+                               (KNIGHT_ATTACKS[square] & (data[WHITE_KNIGHT].value | data[BLACK_KNIGHT].value)) |
+                               (KING_ATTACKS[square] & (data[WHITE_KING].value | data[BLACK_KING].value)) |
+                               (getRookAttacks<Backend>(square, occupied) & straight) |
+                               (getBishopAttacks<Backend>(square, occupied) & diagonal);
+
+    return attackers & occupied;
+}
+
+/** Generate the check and pin information for a side
+ *
+ * Needs allPieces, whitePieces and blackPieces to be up to date.
+ * Finds every piece giving check to the king and every piece pinned to it, so
+ * that no piece has to search for pins on its own.
+ *
+ * @param color Side to generate the information for, true for white
+ */
+template<SliderBackend Backend>
+void Board::generateCheckInfo(bool color)
+{
+    const int own = color ? 0 : 6; // Black pieces are stored after the white pieces
+    const int enemy = color ? 6 : 0;
+    CheckInfo &info = color ? whiteCheckInfo : blackCheckInfo;
+
+    info.pinStraight = 0;
+    info.pinDiagonal = 0;
+
+    if (data[WHITE_KING + own].isEmpty())
+    {
+        // Nothing to protect
+        info.checkers = 0;
+        info.checkMask = ~0ull;
+        return;
+    }
+
+    const unsigned int king = data[WHITE_KING + own].getLsb();
+    const uint64_t occupied = allPieces.value;
+    const uint64_t ownPieces = (color ? whitePieces : blackPieces).value;
+    const uint64_t enemyStraight = data[WHITE_ROOK + enemy].value | data[WHITE_QUEEN + enemy].value;
+    const uint64_t enemyDiagonal = data[WHITE_BISHOP + enemy].value | data[WHITE_QUEEN + enemy].value;
+
+    // Look from the king to find the checkers
+    info.checkers = (KNIGHT_ATTACKS[king] & data[WHITE_KNIGHT + enemy].value) |
+                    (getPawnAttacks(color, king) & data[WHITE_PAWN + enemy].value) |
+                    (getRookAttacks<Backend>(king, occupied) & enemyStraight) |
+                    (getBishopAttacks<Backend>(king, occupied) & enemyDiagonal);
+
+    switch (info.checkers.getBitCount())
+    {
+        case 0:
+            info.checkMask = ~0ull;
+            break;
+        case 1:
+            // Capture the checker or block it
+            info.checkMask = info.checkers.value | getSquaresBetween(king, info.checkers.getLsb());
+            break;
+        default:
+            // Double check, only the king can move
+            info.checkMask = 0;
+            break;
+    }
+
+    // Look through our own pieces to find sliders that would attack the king without them
+    const uint64_t enemyPieces = occupied & ~ownPieces;
+    for (const int pinner: Bitboard(getRookAttacks<Backend>(king, enemyPieces) & enemyStraight))
+    {
+        const uint64_t between = getSquaresBetween(king, pinner);
+        if (std::popcount(between & ownPieces) == 1)
+        {
+            info.pinStraight.value |= between | 1ull << pinner;
+        }
+    }
+
+    for (const int pinner: Bitboard(getBishopAttacks<Backend>(king, enemyPieces) & enemyDiagonal))
+    {
+        const uint64_t between = getSquaresBetween(king, pinner);
+        if (std::popcount(between & ownPieces) == 1)
+        {
+            info.pinDiagonal.value |= between | 1ull << pinner;
+        }
+    }
+}
+
+template void Board::generateCheckInfo<SliderBackend::MAGIC>(bool color);
+template void Board::generateCheckInfo<SliderBackend::PEXT>(bool color);
+template uint64_t Board::getAttackersTo<SliderBackend::MAGIC>(unsigned int square, uint64_t occupied) const;
+template uint64_t Board::getAttackersTo<SliderBackend::PEXT>(unsigned int square, uint64_t occupied) const;
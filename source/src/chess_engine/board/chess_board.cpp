@@ -25,12 +25,14 @@
  * @date 05/25/2024
  *****************************************************************************/
 #include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/bishop.h"
 #include "chess_engine/board/king.h"
 #include "chess_engine/board/knight.h"
 #include "chess_engine/board/pawn.h"
 #include "chess_engine/board/queen.h"
 #include "chess_engine/board/rook.h"
+#include "chess_engine/board/zobrist.h"
 #include "chess_engine/chess_error.h"
 #include "simplelogger.hpp"
 
@@ -102,14 +104,19 @@ void ChessBoard::resetBoard()
     {
         board.value = 0;
     }
+    board.clearMailbox();
 
-    for (bool &castlingRight: castlingRights)
-    {
-        castlingRight = false;
-    }
+    castlingRights = NO_CASTLING_RIGHTS;
 
     enPassantSquare = 65; // No en passant square
     whiteToMove = true;
+
+    hashKey = 0;
+    pawnKey = 0;
+    materialKey = 0;
+
+    psqtScore = {};
+    phase = 0;
 }
 
 /** Create a board from a FEN string
@@ -158,48 +165,51 @@ void ChessBoard::createFromFEN(const std::string &fen, int *halfMoveClock, int *
             continue;
         }
 
-        uint64_t shifted = 0b1ull << piece;
+        PieceLoc location;
         switch (fen[i])
         {
             case 'P':
-                board.data[0].value |= shifted;
+                location = WHITE_PAWN;
                 break;
             case 'N':
-                board.data[1].value |= shifted;
+                location = WHITE_KNIGHT;
                 break;
             case 'B':
-                board.data[2].value |= shifted;
+                location = WHITE_BISHOP;
                 break;
             case 'R':
-                board.data[3].value |= shifted;
+                location = WHITE_ROOK;
                 break;
             case 'Q':
-                board.data[4].value |= shifted;
+                location = WHITE_QUEEN;
                 break;
             case 'K':
-                board.data[5].value |= shifted;
+                location = WHITE_KING;
                 break;
             case 'p':
-                board.data[6].value |= shifted;
+                location = BLACK_PAWN;
                 break;
             case 'n':
-                board.data[7].value |= shifted;
+                location = BLACK_KNIGHT;
                 break;
             case 'b':
-                board.data[8].value |= shifted;
+                location = BLACK_BISHOP;
                 break;
             case 'r':
-                board.data[9].value |= shifted;
+                location = BLACK_ROOK;
                 break;
             case 'q':
-                board.data[10].value |= shifted;
+                location = BLACK_QUEEN;
                 break;
             case 'k':
-                board.data[11].value |= shifted;
+                location = BLACK_KING;
                 break;
             default:
                 throw ChessError("Invalid piece " + std::to_string(fen[i]) + " in FEN");
         }
+
+        board.data[location].value |= 0b1ull << piece;
+        board.mailbox[piece] = location;
         --piece;
     }
 
@@ -254,16 +264,16 @@ void ChessBoard::createFromFEN(const std::string &fen, int *halfMoveClock, int *
             switch (fen[i])
             {
                 case 'K':
-                    castlingRights[0] = true;
+                    castlingRights |= 1 << WHITE_KINGSIDE;
                     break;
                 case 'Q':
-                    castlingRights[1] = true;
+                    castlingRights |= 1 << WHITE_QUEENSIDE;
                     break;
                 case 'k':
-                    castlingRights[2] = true;
+                    castlingRights |= 1 << BLACK_KINGSIDE;
                     break;
                 case 'q':
-                    castlingRights[3] = true;
+                    castlingRights |= 1 << BLACK_QUEENSIDE;
                     break;
                 default:
                     throw ChessError("Invalid castling option in FEN string");
@@ -292,7 +302,7 @@ void ChessBoard::createFromFEN(const std::string &fen, int *halfMoveClock, int *
     }
     else
     {
-        enPassantSquare = getSquareFromAlgebraic(fen.substr(i, 2));
+        enPassantSquare = static_cast<uint8_t>(getSquareFromAlgebraic(fen.substr(i, 2)));
         ++i;
     }
 
@@ -302,11 +312,13 @@ void ChessBoard::createFromFEN(const std::string &fen, int *halfMoveClock, int *
     {
         throw ChessError("Invalid FEN string length while parsing half move clock");
     }
+    int clock = 0;
     while (fen[i] >= '0' and fen[i] <= '9')
     {
+        clock = clock * 10 + (fen[i] - '0');
         if (halfMoveClock)
         {
-            *halfMoveClock = std::stoi(fen.substr(i, 1));
+            *halfMoveClock = clock;
         }
         ++i;
         if (fen.size() <= i)
@@ -320,16 +332,20 @@ void ChessBoard::createFromFEN(const std::string &fen, int *halfMoveClock, int *
     {
         throw ChessError("Invalid FEN string length while parsing full move clock");
     }
+    clock = 0;
     while (fen[i] >= '0' and fen[i] <= '9')
     {
+        clock = clock * 10 + (fen[i] - '0');
         if (fullMoveClock)
         {
-            *fullMoveClock = std::stoi(fen.substr(i, 1));
+            *fullMoveClock = clock;
         }
 
         ++i;
         if (fen.size() <= i)
         {
+            generateHashKeys();
+            generateEvaluation();
             return; // We're done
         }
     }
@@ -395,25 +411,25 @@ std::string ChessBoard::getFEN(int halfMoveClock, int fullMoveClock) const
     }
 
     // Castling rights
-    if (!(castlingRights[0] + castlingRights[1] + castlingRights[2] + castlingRights[3]))
+    if (castlingRights == NO_CASTLING_RIGHTS)
     {
         fen += "-";
     }
     else
     {
-        if (castlingRights[0])
+        if (hasCastlingRight(WHITE_KINGSIDE))
         {
             fen += "K";
         }
-        if (castlingRights[1])
+        if (hasCastlingRight(WHITE_QUEENSIDE))
         {
             fen += "Q";
         }
-        if (castlingRights[2])
+        if (hasCastlingRight(BLACK_KINGSIDE))
         {
             fen += "k";
         }
-        if (castlingRights[3])
+        if (hasCastlingRight(BLACK_QUEENSIDE))
         {
             fen += "q";
         }
@@ -445,64 +461,13 @@ std::string ChessBoard::getFEN(int halfMoveClock, int fullMoveClock) const
  */
 std::string ChessBoard::getDisplayBoard() const
 {
-    std::string dBoard = "";
-    for (int i = 0; i < 64; ++i)
-    {
-        dBoard += "*";
-    }
+    // Characters for each of the bitboards, in the order of PieceLoc
+    constexpr char PIECE_CHARACTERS[13] = {'P', 'N', 'B', 'R', 'Q', 'K', 'p', 'n', 'b', 'r', 'q', 'k', '*'};
 
-    // Generate display board
-    for (int i = 0; i < 12; ++i)
+    std::string dBoard(64, '*');
+    for (int square = 0; square < 64; ++square)
     {
-        for (uint64_t j = 0; j < 64; ++j)
-        {
-            // 1 << j is the bit that represents the square
-            // Initialize and apply the bit mask
-            if (board.data[i].value & (0b1ull << j))
-            {
-                switch (i)
-                {
-                    case PieceLoc::WHITE_PAWN:
-                        dBoard[j] = 'P';
-                        break;
-                    case PieceLoc::WHITE_KNIGHT:
-                        dBoard[j] = 'N';
-                        break;
-                    case PieceLoc::WHITE_BISHOP:
-                        dBoard[j] = 'B';
-                        break;
-                    case PieceLoc::WHITE_ROOK:
-                        dBoard[j] = 'R';
-                        break;
-                    case PieceLoc::WHITE_QUEEN:
-                        dBoard[j] = 'Q';
-                        break;
-                    case PieceLoc::WHITE_KING:
-                        dBoard[j] = 'K';
-                        break;
-                    case PieceLoc::BLACK_PAWN:
-                        dBoard[j] = 'p';
-                        break;
-                    case PieceLoc::BLACK_KNIGHT:
-                        dBoard[j] = 'n';
-                        break;
-                    case PieceLoc::BLACK_BISHOP:
-                        dBoard[j] = 'b';
-                        break;
-                    case PieceLoc::BLACK_ROOK:
-                        dBoard[j] = 'r';
-                        break;
-                    case PieceLoc::BLACK_QUEEN:
-                        dBoard[j] = 'q';
-                        break;
-                    case PieceLoc::BLACK_KING:
-                        dBoard[j] = 'k';
-                        break;
-                    default: // This is impossible
-                        break;
-                }
-            }
-        }
+        dBoard[square] = PIECE_CHARACTERS[board.mailbox[square]];
     }
 
     return dBoard;
@@ -534,3 +499,245 @@ void ChessBoard::printBoard() const
 
     std::cout << "  a b c d e f g h  " << std::endl;
 }
+
+/** Get the en passant capture for a pawn, if it is legal
+ *
+ * En passant removes two pawns from the same rank, so it can uncover a slider on the king even when neither pawn is
+ * pinned. Rather than special casing that, the capture is checked against the occupancy it would leave behind.
+ *
+ * @param color Color of the capturing pawn, true for white
+ * @param square Square of the capturing pawn
+ * @return Bitboard with the en passant target square set, or 0
+ */
+template<SliderBackend Backend>
+uint64_t ChessBoard::getEnPassantMove(bool color, unsigned square) const
+{
+    const unsigned target = enPassantSquare;
+    if (target > 63 or !(getPawnAttacks(color, square) & (1ull << target)))
+    {
+        return 0;
+    }
+
+    const int own = color ? 0 : 6; // Black pieces are stored after the white pieces
+    const int enemy = color ? 6 : 0;
+    const unsigned captured = color ? target - 8 : target + 8;
+    if (!(board.data[WHITE_PAWN + enemy].value & (1ull << captured)))
+    {
+        return 0;
+    }
+
+    // Either the capture removes the checker or the pawn blocks the check
+    const CheckInfo &info = board.getCheckInfo(color);
+    if (!(info.checkMask.value & ((1ull << target) | (1ull << captured))))
+    {
+        return 0;
+    }
+
+    const uint64_t king = board.data[WHITE_KING + own].value;
+    if (!king)
+    {
+        return 1ull << target;
+    }
+
+    const unsigned kingSquare = std::countr_zero(king);
+    const uint64_t occupied = (board.allPieces.value & ~(1ull << square) & ~(1ull << captured)) | (1ull << target);
+    const uint64_t straight = board.data[WHITE_ROOK + enemy].value | board.data[WHITE_QUEEN + enemy].value;
+    const uint64_t diagonal = board.data[WHITE_BISHOP + enemy].value | board.data[WHITE_QUEEN + enemy].value;
+
+    if ((getRookAttacks<Backend>(kingSquare, occupied) & straight) or
+        (getBishopAttacks<Backend>(kingSquare, occupied) & diagonal))
+    {
+        return 0;
+    }
+
+    return 1ull << target;
+}
+
+template uint64_t ChessBoard::getEnPassantMove<SliderBackend::MAGIC>(bool color, unsigned square) const;
+template uint64_t ChessBoard::getEnPassantMove<SliderBackend::PEXT>(bool color, unsigned square) const;
+
+/** Make a move on the board
+ *
+ * Everything a move changes on the board is updated here: the bitboards, the mailbox, the castling
+ * rights and en passant square, the hash keys and the running evaluation. ChessGame::makeMove
+ * saves what it needs to take the move back first, copy-make keeps the parent board instead.
+ * The move must be legal for the side to move.
+ *
+ * @param move The move to make
+ * @param dirty Filled with the pieces that moved, for the network accumulators
+ * @return The captured piece, NO_PIECE if the move is not a capture
+ */
+PieceLoc ChessBoard::makeMove(Move move, DirtyPieces &dirty)
+{
+    const bool color = whiteToMove;
+    const int own = color ? 0 : 6; // Black pieces are stored after the white pieces
+    const int enemy = color ? 6 : 0;
+    Bitboard &ownPieces = color ? board.whitePieces : board.blackPieces;
+    Bitboard &enemyPieces = color ? board.blackPieces : board.whitePieces;
+
+    const unsigned from = move.getFrom();
+    const unsigned to = move.getTo();
+    const uint64_t fromTo = 1ull << from | 1ull << to;
+    const PieceLoc piece = board.getPieceAt(from);
+    PieceLoc captured = NO_PIECE;
+
+    uint64_t newHashKey = hashKey ^ ZOBRIST_BLACK_TO_MOVE;
+    uint64_t newPawnKey = pawnKey;
+
+    // The moving piece goes first, Network::update looks there for king moves
+    dirty.add(piece, from, move.isPromotion() ? 64 : to);
+
+    if (move.isCapture())
+    {
+        // The en passant pawn is behind the target square
+        const unsigned square = move.getFlags() == EN_PASSANT ? (color ? to - 8 : to + 8) : to;
+        captured = move.getFlags() == EN_PASSANT ? static_cast<PieceLoc>(WHITE_PAWN + enemy) : board.getPieceAt(square);
+
+        board.data[captured].value ^= 1ull << square;
+        enemyPieces.value ^= 1ull << square;
+        board.allPieces.value ^= 1ull << square;
+        board.mailbox[square] = NO_PIECE;
+        dirty.add(captured, square, 64);
+
+        newHashKey ^= getPieceKey(captured, square);
+        materialKey ^= getMaterialKey(captured, board.data[captured].getBitCount());
+        psqtScore -= getPieceSquareScore(captured, square);
+        phase -= PHASE_WEIGHTS[captured % 6];
+        if (captured == WHITE_PAWN + enemy)
+        {
+            newPawnKey ^= getPieceKey(captured, square);
+        }
+    }
+
+    board.data[piece].value ^= fromTo;
+    ownPieces.value ^= fromTo;
+    board.allPieces.value ^= fromTo;
+    board.mailbox[from] = NO_PIECE;
+    board.mailbox[to] = piece;
+
+    newHashKey ^= getPieceKey(piece, from) ^ getPieceKey(piece, to);
+    psqtScore += getPieceSquareScore(piece, to) - getPieceSquareScore(piece, from);
+    if (piece == WHITE_PAWN + own)
+    {
+        newPawnKey ^= getPieceKey(piece, from) ^ getPieceKey(piece, to);
+    }
+
+    if (move.isPromotion())
+    {
+        const unsigned promoted = WHITE_KNIGHT + own + move.getPromotionOffset();
+        board.data[piece].value ^= 1ull << to;
+        board.data[promoted].value ^= 1ull << to;
+        board.mailbox[to] = static_cast<PieceLoc>(promoted);
+        dirty.add(static_cast<PieceLoc>(promoted), 64, to);
+
+        newHashKey ^= getPieceKey(piece, to) ^ getPieceKey(promoted, to);
+        newPawnKey ^= getPieceKey(piece, to);
+        materialKey ^= getMaterialKey(piece, board.data[piece].getBitCount()) ^
+                       getMaterialKey(promoted, board.data[promoted].getBitCount() - 1);
+        psqtScore += getPieceSquareScore(promoted, to) - getPieceSquareScore(piece, to);
+        phase += PHASE_WEIGHTS[promoted % 6];
+    }
+    else if (move.isCastle())
+    {
+        const uint64_t rookMove = getCastlingRookMove(move);
+        const auto rook = static_cast<PieceLoc>(WHITE_ROOK + own);
+        board.data[rook].value ^= rookMove;
+        ownPieces.value ^= rookMove;
+        board.allPieces.value ^= rookMove;
+
+        const Bitboard rookSquares(rookMove);
+        const unsigned low = rookSquares.getLsb();
+        const unsigned high = rookSquares.getMsb();
+        if (board.mailbox[low] == rook)
+        {
+            dirty.add(rook, low, high);
+        }
+        else
+        {
+            dirty.add(rook, high, low);
+        }
+
+        for (const int square: Bitboard(rookMove))
+        {
+            newHashKey ^= getPieceKey(rook, square);
+            psqtScore += board.mailbox[square] == rook ? -getPieceSquareScore(rook, square)
+                                                               : getPieceSquareScore(rook, square);
+            board.mailbox[square] = board.mailbox[square] == rook ? NO_PIECE : rook;
+        }
+    }
+
+    const uint8_t newCastlingRights = castlingRights & CASTLING_MASKS[from] & CASTLING_MASKS[to];
+    newHashKey ^= ZOBRIST_CASTLING[castlingRights] ^ ZOBRIST_CASTLING[newCastlingRights];
+    castlingRights = newCastlingRights;
+
+    if (enPassantSquare < 64)
+    {
+        newHashKey ^= ZOBRIST_EN_PASSANT[enPassantSquare % 8];
+    }
+
+    enPassantSquare = 65;
+    if (move.getFlags() == DOUBLE_PAWN_PUSH)
+    {
+        enPassantSquare = (from + to) / 2;
+        newHashKey ^= ZOBRIST_EN_PASSANT[enPassantSquare % 8];
+    }
+
+    hashKey = newHashKey;
+    pawnKey = newPawnKey;
+
+    whiteToMove = !color;
+    board.moveMade();
+
+    return captured;
+}
+
+/** Generate the Zobrist keys of the position from scratch
+ *
+ * Only needed when a position is set up, moves update the keys incrementally.
+ */
+void ChessBoard::generateHashKeys()
+{
+    hashKey = 0;
+    pawnKey = 0;
+    materialKey = 0;
+
+    for (int j = 0; j < 12; ++j)
+    {
+        for (const int square: board.data[j])
+        {
+            hashKey ^= getPieceKey(j, square);
+        }
+
+        for (int count = 0; count < board.data[j].getBitCount(); ++count)
+        {
+            materialKey ^= getMaterialKey(j, count);
+        }
+    }
+
+    for (const int square: Bitboard(board.data[WHITE_PAWN].value | board.data[BLACK_PAWN].value))
+    {
+        pawnKey ^= getPieceKey(board.getPieceAt(square), square);
+    }
+
+    hashKey ^= ZOBRIST_CASTLING[castlingRights];
+
+    if (enPassantSquare < 64)
+    {
+        hashKey ^= ZOBRIST_EN_PASSANT[enPassantSquare % 8];
+    }
+
+    if (!whiteToMove)
+    {
+        hashKey ^= ZOBRIST_BLACK_TO_MOVE;
+    }
+}
+
+/** Generate the running evaluation of the position from scratch
+ *
+ * Only needed when a position is set up, moves update the score and phase incrementally.
+ */
+void ChessBoard::generateEvaluation()
+{
+    psqtScore = computePieceSquareScore(*this);
+    phase = computePhase(*this);
+}
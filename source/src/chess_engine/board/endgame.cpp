@@ -0,0 +1,391 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * endgame.cpp - Specialized evaluation of known endgames
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/endgame.h"
+#include "chess_engine/board/attack_tables.h"
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/evaluation.h"
+#include "chess_engine/board/piece.h"
+#include "chess_engine/board/zobrist.h"
+#include "chess_engine/chess_error.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+using namespace chessengine::board;
+
+namespace
+{
+
+/* Square 0 is h1, files count from the a file */
+constexpr int getFile(const unsigned square) { return 7 - static_cast<int>(square % 8); }
+constexpr int getRank(const unsigned square) { return static_cast<int>(square / 8); }
+
+constexpr int getDistance(const unsigned first, const unsigned second)
+{
+    return std::max(std::abs(getFile(first) - getFile(second)), std::abs(getRank(first) - getRank(second)));
+}
+
+/** Get a square as seen by a side, black's squares are flipped so its pawns move north */
+constexpr unsigned getRelativeSquare(const bool side, const unsigned square) { return side == WHITE ? square : square ^ 56; }
+
+unsigned getSquare(const ChessBoard &board, const unsigned piece) { return board.board.data[piece].getLsb(); }
+
+unsigned getOffset(const bool side) { return side == WHITE ? 0 : 6; }
+
+// ---------------------------------- KPK bitbase ----------------------------------
+
+/* Positions with the strong side's pawn on the a to d file and the second to seventh rank */
+constexpr unsigned KPK_SIZE = 2 * 24 * 64 * 64;
+
+enum KpkResult : uint8_t
+{
+    KPK_INVALID = 0,
+    KPK_UNKNOWN = 1,
+    KPK_DRAW = 2,
+    KPK_WIN = 4
+};
+
+unsigned getKpkIndex(const bool strongToMove, const unsigned strongKing, const unsigned weakKing, const unsigned pawn)
+{
+    const unsigned pawnIndex = (getRank(pawn) - 1) * 4 + getFile(pawn);
+    return ((pawnIndex * 64 + strongKing) * 64 + weakKing) * 2 + strongToMove;
+}
+
+/** Classify a position before looking at any moves
+ *
+ * @return KPK_INVALID for illegal positions, the result if it is clear without searching, KPK_UNKNOWN otherwise
+ */
+KpkResult getInitialKpkResult(const bool strongToMove, const unsigned strongKing, const unsigned weakKing,
+                              const unsigned pawn)
+{
+    const uint64_t pawnAttacks = getPawnAttacks(WHITE, pawn);
+    if (getDistance(strongKing, weakKing) <= 1 or strongKing == pawn or weakKing == pawn or
+        (strongToMove and pawnAttacks >> weakKing & 1))
+    {
+        return KPK_INVALID;
+    }
+
+    // The pawn queens and the weak king can't take the queen right away
+    const unsigned promotion = pawn + 8;
+    if (strongToMove and getRank(pawn) == 6 and strongKing != promotion and
+        (getDistance(weakKing, promotion) > 1 or KING_ATTACKS[strongKing] >> promotion & 1))
+    {
+        return KPK_WIN;
+    }
+
+    // Stalemate, or the weak king takes the pawn
+    if (not strongToMove and
+        ((KING_ATTACKS[weakKing] & ~(KING_ATTACKS[strongKing] | pawnAttacks)) == 0 or
+         (KING_ATTACKS[weakKing] & ~KING_ATTACKS[strongKing]) >> pawn & 1))
+    {
+        return KPK_DRAW;
+    }
+
+    return KPK_UNKNOWN;
+}
+
+/** Classify a position from the results of the positions its moves lead to */
+KpkResult classifyKpk(const std::vector<uint8_t> &results, const bool strongToMove, const unsigned strongKing,
+                      const unsigned weakKing, const unsigned pawn)
+{
+    uint8_t successors = 0;
+    if (strongToMove)
+    {
+        for (const int square: Bitboard(KING_ATTACKS[strongKing]))
+        {
+            successors |= results[getKpkIndex(false, square, weakKing, pawn)];
+        }
+
+        const unsigned push = pawn + 8;
+        if (getRank(pawn) < 6 and push != strongKing and push != weakKing)
+        {
+            successors |= results[getKpkIndex(false, strongKing, weakKing, push)];
+
+            const unsigned doublePush = push + 8;
+            if (getRank(pawn) == 1 and doublePush != strongKing and doublePush != weakKing)
+            {
+                successors |= results[getKpkIndex(false, strongKing, weakKing, doublePush)];
+            }
+        }
+
+        return successors & KPK_WIN ? KPK_WIN : successors & KPK_UNKNOWN ? KPK_UNKNOWN : KPK_DRAW;
+    }
+
+    for (const int square: Bitboard(KING_ATTACKS[weakKing]))
+    {
+        successors |= results[getKpkIndex(true, strongKing, square, pawn)];
+    }
+
+    return successors & KPK_DRAW ? KPK_DRAW : successors & KPK_UNKNOWN ? KPK_UNKNOWN : KPK_WIN;
+}
+
+/** Solve every king and pawn against king position by going backwards from the clear ones
+ *
+ * Takes a few milliseconds, it is only done the first time KPK is probed.
+ */
+std::bitset<KPK_SIZE> generateKpkBitbase()
+{
+    std::vector<uint8_t> results(KPK_SIZE, KPK_INVALID);
+    std::vector<unsigned> unknown;
+
+    for (unsigned pawnIndex = 0; pawnIndex < 24; ++pawnIndex)
+    {
+        // Files a to d are squares 7 to 4 of each rank
+        const unsigned pawn = (pawnIndex / 4 + 1) * 8 + 7 - pawnIndex % 4;
+        for (unsigned strongKing = 0; strongKing < 64; ++strongKing)
+        {
+            for (unsigned weakKing = 0; weakKing < 64; ++weakKing)
+            {
+                for (const bool strongToMove: {false, true})
+                {
+                    const unsigned index = getKpkIndex(strongToMove, strongKing, weakKing, pawn);
+                    results[index] = getInitialKpkResult(strongToMove, strongKing, weakKing, pawn);
+                    if (results[index] == KPK_UNKNOWN)
+                    {
+                        unknown.push_back(index);
+                    }
+                }
+            }
+        }
+    }
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (const unsigned index: unknown)
+        {
+            if (results[index] != KPK_UNKNOWN)
+            {
+                continue;
+            }
+
+            const bool strongToMove = index & 1;
+            const unsigned weakKing = index / 2 % 64;
+            const unsigned strongKing = index / 128 % 64;
+            const unsigned pawnIndex = index / (128 * 64);
+            const unsigned pawn = (pawnIndex / 4 + 1) * 8 + 7 - pawnIndex % 4;
+
+            results[index] = classifyKpk(results, strongToMove, strongKing, weakKing, pawn);
+            changed |= results[index] != KPK_UNKNOWN;
+        }
+    }
+
+    // Whatever is still unknown can't be forced, so it is a draw
+    std::bitset<KPK_SIZE> wins;
+    for (unsigned index = 0; index < KPK_SIZE; ++index)
+    {
+        wins[index] = results[index] == KPK_WIN;
+    }
+
+    return wins;
+}
+
+// ---------------------------------- Endgame lookup ----------------------------------
+
+std::unordered_map<uint64_t, Endgame> generateEndgames()
+{
+    const std::pair<const char *, EndgameFunction> endgames[] = {
+            {"KBNK", evaluateKBNK},
+            {"KPK", evaluateKPK},
+            {"KRKP", evaluateKRKP},
+    };
+
+    std::unordered_map<uint64_t, Endgame> map;
+    for (const auto &[pieces, function]: endgames)
+    {
+        for (const bool strongSide: {WHITE, BLACK})
+        {
+            map[computeMaterialKey(pieces, strongSide)] = {function, strongSide};
+        }
+    }
+
+    return map;
+}
+
+} // namespace
+
+/** Look up a king and pawn against king position
+ *
+ * @param strongKing King of the side with the pawn
+ * @param weakKing Other king
+ * @param pawn Pawn, moving north
+ * @param strongToMove Whether the side with the pawn is to move
+ * @return Whether the side with the pawn wins
+ */
+bool chessengine::board::probeKPK(unsigned strongKing, unsigned weakKing, unsigned pawn, const bool strongToMove)
+{
+    static const std::bitset<KPK_SIZE> KPK_BITBASE = generateKpkBitbase();
+
+    // The bitbase only has the pawn on the queen side, the king side is its mirror image
+    if (getFile(pawn) >= 4)
+    {
+        strongKing ^= 7;
+        weakKing ^= 7;
+        pawn ^= 7;
+    }
+
+    return KPK_BITBASE[getKpkIndex(strongToMove, strongKing, weakKing, pawn)];
+}
+
+/** Drive the weak king into a corner of the bishop's color, where bishop and knight can mate it */
+int chessengine::board::evaluateKBNK(const ChessBoard &board, const bool strongSide)
+{
+    const unsigned own = getOffset(strongSide);
+    const unsigned strongKing = getSquare(board, WHITE_KING + own);
+    const unsigned weakKing = getSquare(board, WHITE_KING + getOffset(not strongSide));
+    const unsigned bishop = getSquare(board, WHITE_BISHOP + own);
+
+    // a1 and h8 are dark squares, square 7 is a1
+    const bool darkBishop = (getFile(bishop) + getRank(bishop)) % 2 == 0;
+    const int cornerDistance = darkBishop ? std::min(getDistance(weakKing, 7), getDistance(weakKing, 56))
+                                          : std::min(getDistance(weakKing, 0), getDistance(weakKing, 63));
+
+    return KNOWN_WIN + 100 * (7 - cornerDistance) + 20 * (7 - getDistance(strongKing, weakKing));
+}
+
+/** Look the position up in the KPK bitbase, a won position is worth more the further the pawn is */
+int chessengine::board::evaluateKPK(const ChessBoard &board, const bool strongSide)
+{
+    const unsigned strongKing = getRelativeSquare(strongSide, getSquare(board, WHITE_KING + getOffset(strongSide)));
+    const unsigned weakKing = getRelativeSquare(strongSide, getSquare(board, WHITE_KING + getOffset(not strongSide)));
+    const unsigned pawn = getRelativeSquare(strongSide, getSquare(board, WHITE_PAWN + getOffset(strongSide)));
+
+    if (not probeKPK(strongKing, weakKing, pawn, board.whiteToMove == strongSide))
+    {
+        return 0;
+    }
+
+    return KNOWN_WIN + MATERIAL_SCORES[0].eg + 20 * getRank(pawn);
+}
+
+/** Rook against pawn, won unless the pawn is far advanced and its king supports it */
+int chessengine::board::evaluateKRKP(const ChessBoard &board, const bool strongSide)
+{
+    const unsigned strongKing = getRelativeSquare(strongSide, getSquare(board, WHITE_KING + getOffset(strongSide)));
+    const unsigned weakKing = getRelativeSquare(strongSide, getSquare(board, WHITE_KING + getOffset(not strongSide)));
+    const unsigned rook = getRelativeSquare(strongSide, getSquare(board, WHITE_ROOK + getOffset(strongSide)));
+    const unsigned pawn = getRelativeSquare(strongSide, getSquare(board, WHITE_PAWN + getOffset(not strongSide)));
+
+    // Seen from the strong side the pawn moves south
+    const unsigned queening = pawn % 8;
+    const unsigned stop = pawn - 8;
+    const bool strongToMove = board.whiteToMove == strongSide;
+    const int rookValue = MATERIAL_SCORES[3].eg;
+
+    // The strong king is in front of the pawn
+    if (getFile(strongKing) == getFile(pawn) and getRank(strongKing) < getRank(pawn))
+    {
+        return rookValue - getDistance(strongKing, pawn);
+    }
+
+    // The weak king is too far away from its pawn and the rook
+    if (getDistance(weakKing, pawn) >= 3 + (strongToMove ? 0 : 1) and getDistance(weakKing, rook) >= 3)
+    {
+        return rookValue - getDistance(strongKing, pawn);
+    }
+
+    // The pawn is far advanced, supported by its king and the strong king is far away
+    if (getRank(weakKing) <= 2 and getDistance(weakKing, pawn) == 1 and getRank(strongKing) >= 3 and
+        getDistance(strongKing, pawn) > 2 + (strongToMove ? 1 : 0))
+    {
+        return 80 - 8 * getDistance(strongKing, pawn);
+    }
+
+    return 200 - 8 * (getDistance(strongKing, stop) - getDistance(weakKing, stop) - getDistance(pawn, queening));
+}
+
+/** Bishops on opposite colors with nothing but pawns besides are very drawish */
+int chessengine::board::scaleOppositeBishops(const ChessBoard &board, const bool strongSide)
+{
+    const unsigned ownBishop = getSquare(board, WHITE_BISHOP + getOffset(strongSide));
+    const unsigned enemyBishop = getSquare(board, WHITE_BISHOP + getOffset(not strongSide));
+    if ((getFile(ownBishop) + getRank(ownBishop)) % 2 == (getFile(enemyBishop) + getRank(enemyBishop)) % 2)
+    {
+        return SCALE_NORMAL;
+    }
+
+    const int pawnDifference = board.board.data[WHITE_PAWN + getOffset(strongSide)].getBitCount() -
+                               board.board.data[WHITE_PAWN + getOffset(not strongSide)].getBitCount();
+    return pawnDifference <= 1 ? SCALE_NORMAL / 4 : SCALE_NORMAL / 2;
+}
+
+/** Compute the material key of a configuration
+ *
+ * @param pieces Pieces of the strong side starting with its king, then the pieces of the weak side
+ *               starting with its king, as in "KRKP"
+ * @param strongSide Color of the strong side
+ * @return Material key of a board with those pieces
+ */
+uint64_t chessengine::board::computeMaterialKey(const std::string &pieces, const bool strongSide) noexcept(false)
+{
+    const size_t weakKing = pieces.find('K', 1);
+    if (pieces.empty() or pieces[0] != 'K' or weakKing == std::string::npos)
+    {
+        throw ChessError("Invalid material configuration " + pieces);
+    }
+
+    unsigned counts[12]{};
+    for (size_t i = 0; i < pieces.size(); ++i)
+    {
+        const size_t type = std::string("PNBRQK").find(pieces[i]);
+        if (type == std::string::npos)
+        {
+            throw ChessError("Invalid material configuration " + pieces);
+        }
+
+        const bool color = i < weakKing ? strongSide : not strongSide;
+        ++counts[type + getOffset(color)];
+    }
+
+    uint64_t key = 0;
+    for (unsigned piece = 0; piece < 12; ++piece)
+    {
+        for (unsigned count = 0; count < counts[piece]; ++count)
+        {
+            key ^= getMaterialKey(piece, count);
+        }
+    }
+
+    return key;
+}
+
+/** Find the endgame function of a material configuration
+ *
+ * @param materialKey Material key of the board
+ * @return The endgame, nullptr if there is no function for the configuration
+ */
+const Endgame *chessengine::board::findEndgame(const uint64_t materialKey)
+{
+    static const std::unordered_map<uint64_t, Endgame> ENDGAMES = generateEndgames();
+
+    const auto endgame = ENDGAMES.find(materialKey);
+    return endgame == ENDGAMES.end() ? nullptr : &endgame->second;
+}
@@ -0,0 +1,121 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * evaluation.cpp - Tapered piece-square table evaluation
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/evaluation.h"
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/material.h"
+#include "chess_engine/board/pawn_structure.h"
+
+#include <algorithm>
+
+using namespace chessengine::board;
+
+/** Add up the material and piece-square scores of every piece on the board
+ *
+ * @param board Board to score
+ * @return Score from white's point of view
+ */
+Score chessengine::board::computePieceSquareScore(const ChessBoard &board)
+{
+    Score score;
+    for (unsigned j = 0; j < 12; ++j)
+    {
+        for (const int square: board.board.data[j])
+        {
+            score += getPieceSquareScore(j, square);
+        }
+    }
+
+    return score;
+}
+
+/** Add up the phase weights of every piece on the board
+ *
+ * @param board Board to look at
+ * @return Game phase, above MAX_PHASE after promotions
+ */
+int chessengine::board::computePhase(const ChessBoard &board)
+{
+    int phase = 0;
+    for (unsigned j = 0; j < 12; ++j)
+    {
+        phase += PHASE_WEIGHTS[j % 6] * static_cast<int>(board.board.data[j].getBitCount());
+    }
+
+    return phase;
+}
+
+/** Evaluate a position from the running score kept by make and unmake
+ *
+ * @param board Board to evaluate
+ * @return Score in centipawns from the side to move's point of view
+ */
+int chessengine::board::evaluate(const ChessBoard &board)
+{
+    const int score = taper(board.psqtScore, std::min(board.phase, MAX_PHASE));
+    return board.whiteToMove ? score : -score;
+}
+
+/** Evaluate a position from the running score, the material configuration and the pawn structure
+ *
+ * Known endgames are evaluated by their own function and skip everything else.
+ *
+ * @param board Board to evaluate
+ * @param pawnTable Pawn hash table of the thread doing the evaluation
+ * @param materialTable Material hash table of the thread doing the evaluation
+ * @return Score in centipawns from the side to move's point of view
+ */
+int chessengine::board::evaluate(const ChessBoard &board, PawnTable &pawnTable, MaterialTable &materialTable)
+{
+    const MaterialEntry &material = materialTable.probe(board);
+    if (material.evaluationFunction != nullptr)
+    {
+        const int score = material.evaluationFunction(board, material.strongSide);
+        return board.whiteToMove == material.strongSide ? score : -score;
+    }
+
+    Score score = board.psqtScore + material.imbalance + evaluatePawns(board, pawnTable);
+
+    const bool strongSide = score.eg > 0;
+    const ScaleFunction scaleFunction = material.scaleFunctions[strongSide];
+    const int scaleFactor =
+            scaleFunction != nullptr ? scaleFunction(board, strongSide) : material.scaleFactors[strongSide];
+    score.eg = score.eg * scaleFactor / SCALE_NORMAL;
+
+    const int value = taper(score, material.phase);
+    return board.whiteToMove ? value : -value;
+}
+
+/** Evaluate a position by going over every piece, for checking the running score
+ *
+ * @param board Board to evaluate
+ * @return The same as evaluate when the running score is up to date
+ */
+int chessengine::board::evaluateFromScratch(const ChessBoard &board)
+{
+    const int score = taper(computePieceSquareScore(board), std::min(computePhase(board), MAX_PHASE));
+    return board.whiteToMove ? score : -score;
+}
@@ -0,0 +1,165 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * material.cpp - Material configurations and their hash table
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/material.h"
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/piece.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace chessengine::board;
+
+namespace
+{
+
+Score multiply(const Score &score, const int count) { return {score.mg * count, score.eg * count}; }
+
+/** Imbalance score of one side's pieces
+ *
+ * @param counts Number of pawns, knights, bishops, rooks and queens of the side
+ */
+Score getImbalance(const int counts[6])
+{
+    Score score;
+    if (counts[2] >= 2)
+    {
+        score += BISHOP_PAIR;
+    }
+
+    score += multiply(KNIGHT_PAWN_ADJUSTMENT, counts[1] * (counts[0] - 5));
+    score += multiply(ROOK_PAWN_ADJUSTMENT, counts[3] * (counts[0] - 5));
+    return score;
+}
+
+/** Midgame value of the pieces other than pawns */
+int getNonPawnMaterial(const int counts[6])
+{
+    int material = 0;
+    for (unsigned type = 1; type < 5; ++type)
+    {
+        material += counts[type] * MATERIAL_SCORES[type].mg;
+    }
+
+    return material;
+}
+
+} // namespace
+
+/** Create a table with room for a number of material configurations
+ *
+ * @param entries Number of entries, rounded up to a power of two
+ */
+MaterialTable::MaterialTable(const size_t entries) : m_entries(std::bit_ceil(std::max<size_t>(entries, 1))) {}
+
+/** Find the entry of a board's material configuration, computing it when the table doesn't have it
+ *
+ * @param board Board to look up
+ * @return Entry of the configuration, valid until the next probe
+ */
+const MaterialEntry &MaterialTable::probe(const ChessBoard &board)
+{
+    ++m_probes;
+    MaterialEntry &entry = m_entries[board.materialKey & (m_entries.size() - 1)];
+    if (entry.key == board.materialKey)
+    {
+        ++m_hits;
+        return entry;
+    }
+
+    computeMaterialEntry(board, entry);
+    return entry;
+}
+
+/** Forget every material configuration */
+void MaterialTable::clear()
+{
+    std::fill(m_entries.begin(), m_entries.end(), MaterialEntry{});
+    m_probes = 0;
+    m_hits = 0;
+}
+
+/** Compute everything about the material configuration of a board from scratch
+ *
+ * @param board Board to look at
+ * @param entry Entry to fill in
+ */
+void chessengine::board::computeMaterialEntry(const ChessBoard &board, MaterialEntry &entry)
+{
+    entry = MaterialEntry{};
+    entry.key = board.materialKey;
+
+    int counts[2][6];
+    for (unsigned piece = 0; piece < 12; ++piece)
+    {
+        counts[piece < 6 ? WHITE : BLACK][piece % 6] = board.board.data[piece].getBitCount();
+    }
+
+    for (unsigned type = 0; type < 6; ++type)
+    {
+        entry.phase += PHASE_WEIGHTS[type] * (counts[WHITE][type] + counts[BLACK][type]);
+    }
+    entry.phase = std::min(entry.phase, MAX_PHASE);
+
+    if (const Endgame *endgame = findEndgame(entry.key))
+    {
+        entry.evaluationFunction = endgame->evaluate;
+        entry.strongSide = endgame->strongSide;
+        return;
+    }
+
+    entry.imbalance = getImbalance(counts[WHITE]) - getImbalance(counts[BLACK]);
+
+    // A bishop each and nothing else but pawns
+    const bool bishopsOnly = getNonPawnMaterial(counts[WHITE]) == MATERIAL_SCORES[2].mg and
+                             getNonPawnMaterial(counts[BLACK]) == MATERIAL_SCORES[2].mg and
+                             counts[WHITE][2] == 1 and counts[BLACK][2] == 1;
+
+    for (const bool side: {WHITE, BLACK})
+    {
+        if (bishopsOnly and counts[side][0] + counts[not side][0] > 0)
+        {
+            entry.scaleFunctions[side] = scaleOppositeBishops;
+        }
+
+        // Without pawns a side needs more than a minor piece up to win
+        const int material = getNonPawnMaterial(counts[side]);
+        const int enemyMaterial = getNonPawnMaterial(counts[not side]);
+        if (counts[side][0] != 0 or material - enemyMaterial > MATERIAL_SCORES[2].mg)
+        {
+            continue;
+        }
+
+        if (material < MATERIAL_SCORES[3].mg)
+        {
+            entry.scaleFactors[side] = SCALE_DRAW;
+        }
+        else
+        {
+            entry.scaleFactors[side] = enemyMaterial <= MATERIAL_SCORES[2].mg ? 4 : 14;
+        }
+    }
+}
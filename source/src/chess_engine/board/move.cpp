@@ -0,0 +1,57 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * move.cpp - Packed move type and fixed-capacity move list
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/move.h"
+#include "chess_engine/board/chess_board.h"
+
+#include <algorithm>
+
+using namespace chessengine::board;
+
+/** Get the move in the long algebraic form used by UCI, e.g. e2e4 or e7e8q
+ *
+ * @return String representation of the move
+ */
+std::string Move::toString() const
+{
+    std::string move = ChessBoard::toAlgebraic(getFrom()) + ChessBoard::toAlgebraic(getTo());
+    if (isPromotion())
+    {
+        move += "nbrq"[getPromotionOffset()];
+    }
+
+    return move;
+}
+
+/** Check if the list holds a move
+ *
+ * @param move Move to look for
+ * @return True if the move is in the list
+ */
+bool MoveList::contains(Move move) const
+{
+    return std::find(begin(), end(), move) != end();
+}
@@ -0,0 +1,421 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * nnue.cpp - HalfKP neural network evaluation
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/nnue.h"
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/piece.h"
+#include "chess_engine/chess_error.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef CHESS_ENGINE_NNUE_X86
+#if defined(_MSC_VER) and not defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+using namespace chessengine::board;
+
+namespace
+{
+
+constexpr size_t align(const size_t offset) { return (offset + 63) / 64 * 64; }
+
+/** Offsets of every section in the network file */
+struct NetworkLayout
+{
+    static constexpr size_t HEADER_SIZE = 64;
+    static constexpr size_t FEATURE_BIASES = HEADER_SIZE;
+    static constexpr size_t FEATURE_WEIGHTS = align(FEATURE_BIASES + NNUE_L1 * sizeof(int16_t));
+    static constexpr size_t HIDDEN1_BIASES = align(FEATURE_WEIGHTS + NNUE_FEATURES * NNUE_L1 * sizeof(int16_t));
+    static constexpr size_t HIDDEN1_WEIGHTS = align(HIDDEN1_BIASES + NNUE_L2 * sizeof(int32_t));
+    static constexpr size_t HIDDEN2_BIASES = align(HIDDEN1_WEIGHTS + NNUE_L2 * 2 * NNUE_L1);
+    static constexpr size_t HIDDEN2_WEIGHTS = align(HIDDEN2_BIASES + NNUE_L3 * sizeof(int32_t));
+    static constexpr size_t OUTPUT_BIAS = align(HIDDEN2_WEIGHTS + NNUE_L3 * NNUE_L2);
+    static constexpr size_t OUTPUT_WEIGHTS = align(OUTPUT_BIAS + sizeof(int32_t));
+    static constexpr size_t FILE_SIZE = align(OUTPUT_WEIGHTS + NNUE_L3);
+};
+
+/** Check which instruction sets the processor and the operating system support */
+std::vector<const NnueKernels *> detectKernels()
+{
+    std::vector<const NnueKernels *> kernels;
+#ifdef CHESS_ENGINE_NNUE_X86
+#if defined(_MSC_VER) and not defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+
+    __cpuid(info, 1);
+    const bool sse41 = info[2] & 1 << 19;
+    const bool osSaves = info[2] & 1 << 27;
+    const uint64_t xcr0 = osSaves ? _xgetbv(0) : 0;
+    const bool avxState = (xcr0 & 0x6) == 0x6;
+    const bool avx512State = (xcr0 & 0xe6) == 0xe6;
+
+    bool avx2 = false;
+    bool avx512 = false;
+    if (maxLeaf >= 7)
+    {
+        __cpuidex(info, 7, 0);
+        avx2 = avxState and info[1] & 1 << 5;
+        avx512 = avx512State and info[1] & 1 << 16 and info[1] & 1 << 30;
+    }
+#else
+    __builtin_cpu_init();
+    const bool sse41 = __builtin_cpu_supports("sse4.1");
+    const bool avx2 = __builtin_cpu_supports("avx2");
+    const bool avx512 = __builtin_cpu_supports("avx512f") and __builtin_cpu_supports("avx512bw");
+#endif
+
+    if (avx512 and avx2)
+    {
+        kernels.push_back(&AVX512_KERNELS);
+    }
+    if (avx2)
+    {
+        kernels.push_back(&AVX2_KERNELS);
+    }
+    if (sse41)
+    {
+        kernels.push_back(&SSE41_KERNELS);
+    }
+#endif
+    kernels.push_back(&SCALAR_KERNELS);
+
+    return kernels;
+}
+
+/* Best kernels first */
+const std::vector<const NnueKernels *> AVAILABLE_KERNELS = detectKernels();
+const NnueKernels *g_kernels = AVAILABLE_KERNELS.front();
+
+/** Index of a piece on a square as seen from one perspective
+ *
+ * @param perspective Color whose accumulator the feature belongs to
+ * @param kingSquare Square of that color's king
+ * @param piece Piece, not a king
+ * @param square Square of the piece
+ */
+unsigned getFeatureIndex(const bool perspective, const unsigned kingSquare, const unsigned piece,
+                         const unsigned square)
+{
+    const unsigned flip = perspective == WHITE ? 0 : 56;
+    const bool ownPiece = (piece < BLACK_PAWN) == perspective;
+    const unsigned pieceIndex = (ownPiece ? 0 : 5) + piece % 6;
+
+    return ((kingSquare ^ flip) * 10 + pieceIndex) * 64 + (square ^ flip);
+}
+
+bool isKing(const unsigned piece) { return piece == WHITE_KING or piece == BLACK_KING; }
+
+/** Shift the hidden layer sums down and clamp them to [0, 127] */
+void activate(const int32_t *input, uint8_t *output, const unsigned size)
+{
+    for (unsigned i = 0; i < size; ++i)
+    {
+        output[i] = static_cast<uint8_t>(std::clamp(input[i] >> NNUE_WEIGHT_SHIFT, 0, 127));
+    }
+}
+
+} // namespace
+
+std::vector<const NnueKernels *> chessengine::board::getAvailableNnueKernels() { return AVAILABLE_KERNELS; }
+
+const NnueKernels &chessengine::board::getNnueKernels() { return *g_kernels; }
+
+/** Pick the kernels by name, meant for benchmarks and tests. Not thread safe, call it while nothing searches
+ *
+ * @param name Name of kernels returned by getAvailableNnueKernels
+ */
+void chessengine::board::setNnueKernels(const std::string &name) noexcept(false)
+{
+    for (const NnueKernels *kernels: AVAILABLE_KERNELS)
+    {
+        if (name == kernels->name)
+        {
+            g_kernels = kernels;
+            return;
+        }
+    }
+
+    throw ChessError("NNUE kernels " + name + " are not available on this processor");
+}
+
+Network::~Network() { unmap(); }
+
+void Network::unmap()
+{
+    if (m_mapping != nullptr)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_mapping);
+#else
+        munmap(m_mapping, m_size);
+#endif
+    }
+
+    m_mapping = nullptr;
+    m_size = 0;
+}
+
+/** Memory map a network file, replacing any network loaded before
+ *
+ * @param path Path of the network file
+ */
+void Network::load(const std::string &path) noexcept(false)
+{
+    unmap();
+
+#ifdef _WIN32
+    const HANDLE file =
+            CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw ChessError("Unable to open network file " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (not GetFileSizeEx(file, &fileSize) or static_cast<size_t>(fileSize.QuadPart) != getFileSize())
+    {
+        CloseHandle(file);
+        throw ChessError("Network file " + path + " has the wrong size");
+    }
+
+    // The view keeps the mapping alive, both handles can be closed right away
+    const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        throw ChessError("Unable to map network file " + path);
+    }
+
+    m_mapping = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (m_mapping == nullptr)
+    {
+        throw ChessError("Unable to map network file " + path);
+    }
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        throw ChessError("Unable to open network file " + path);
+    }
+
+    struct stat fileStat{};
+    if (fstat(file, &fileStat) != 0 or static_cast<size_t>(fileStat.st_size) != getFileSize())
+    {
+        close(file);
+        throw ChessError("Network file " + path + " has the wrong size");
+    }
+
+    void *mapping = mmap(nullptr, getFileSize(), PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (mapping == MAP_FAILED)
+    {
+        throw ChessError("Unable to map network file " + path);
+    }
+    m_mapping = mapping;
+#endif
+    m_size = getFileSize();
+
+    const auto *bytes = static_cast<const char *>(m_mapping);
+    uint32_t version;
+    std::memcpy(&version, bytes + sizeof(NNUE_MAGIC), sizeof(version));
+    if (std::memcmp(bytes, NNUE_MAGIC, sizeof(NNUE_MAGIC)) != 0 or version != NNUE_VERSION)
+    {
+        unmap();
+        throw ChessError("Network file " + path + " is not a version " + std::to_string(NNUE_VERSION) + " network");
+    }
+
+    m_featureBiases = reinterpret_cast<const int16_t *>(bytes + NetworkLayout::FEATURE_BIASES);
+    m_featureWeights = reinterpret_cast<const int16_t *>(bytes + NetworkLayout::FEATURE_WEIGHTS);
+    m_hidden1Biases = reinterpret_cast<const int32_t *>(bytes + NetworkLayout::HIDDEN1_BIASES);
+    m_hidden1Weights = reinterpret_cast<const int8_t *>(bytes + NetworkLayout::HIDDEN1_WEIGHTS);
+    m_hidden2Biases = reinterpret_cast<const int32_t *>(bytes + NetworkLayout::HIDDEN2_BIASES);
+    m_hidden2Weights = reinterpret_cast<const int8_t *>(bytes + NetworkLayout::HIDDEN2_WEIGHTS);
+    m_outputBias = reinterpret_cast<const int32_t *>(bytes + NetworkLayout::OUTPUT_BIAS);
+    m_outputWeights = reinterpret_cast<const int8_t *>(bytes + NetworkLayout::OUTPUT_WEIGHTS);
+}
+
+/** Compute one perspective of an accumulator from scratch
+ *
+ * @param board Position to compute
+ * @param perspective Color of the perspective
+ * @param accumulator Accumulator to fill in
+ */
+void Network::refresh(const ChessBoard &board, const bool perspective, Accumulator &accumulator) const
+{
+    const NnueKernels &kernels = getNnueKernels();
+    const unsigned kingSquare = board.board.data[perspective == WHITE ? WHITE_KING : BLACK_KING].getLsb();
+
+    int16_t *values = accumulator.values[perspective];
+    std::memcpy(values, m_featureBiases, sizeof(accumulator.values[perspective]));
+    for (unsigned piece = 0; piece < 12; ++piece)
+    {
+        if (isKing(piece))
+        {
+            continue;
+        }
+
+        for (const int square: board.board.data[piece])
+        {
+            kernels.addRow(values, m_featureWeights + getFeatureIndex(perspective, kingSquare, piece, square) * NNUE_L1);
+        }
+    }
+}
+
+/** Update the accumulator of a position from the one before the move
+ *
+ * @param board Position after the move
+ * @param dirty Pieces the move changed
+ * @param parent Accumulator before the move
+ * @param child Accumulator to fill in
+ */
+void Network::update(const ChessBoard &board, const DirtyPieces &dirty, const Accumulator &parent,
+                     Accumulator &child) const
+{
+    const NnueKernels &kernels = getNnueKernels();
+    for (const bool perspective: {WHITE, BLACK})
+    {
+        const PieceLoc king = perspective == WHITE ? WHITE_KING : BLACK_KING;
+        if (dirty.pieces[0] == king)
+        {
+            // Every feature depends on the king square
+            refresh(board, perspective, child);
+            continue;
+        }
+
+        const unsigned kingSquare = board.board.data[king].getLsb();
+        int16_t *values = child.values[perspective];
+        std::memcpy(values, parent.values[perspective], sizeof(parent.values[perspective]));
+        for (unsigned i = 0; i < dirty.count; ++i)
+        {
+            const PieceLoc piece = dirty.pieces[i];
+            if (isKing(piece))
+            {
+                continue;
+            }
+
+            if (dirty.from[i] < 64)
+            {
+                kernels.subRow(values,
+                               m_featureWeights + getFeatureIndex(perspective, kingSquare, piece, dirty.from[i]) * NNUE_L1);
+            }
+            if (dirty.to[i] < 64)
+            {
+                kernels.addRow(values,
+                               m_featureWeights + getFeatureIndex(perspective, kingSquare, piece, dirty.to[i]) * NNUE_L1);
+            }
+        }
+    }
+}
+
+/** Run the layers after the accumulator
+ *
+ * @param accumulator Accumulator of the position
+ * @param whiteToMove Side to move, its perspective goes first
+ * @return Score in centipawns from the side to move's point of view
+ */
+int Network::evaluate(const Accumulator &accumulator, const bool whiteToMove) const
+{
+    const NnueKernels &kernels = getNnueKernels();
+
+    alignas(64) uint8_t transformed[2 * NNUE_L1];
+    kernels.clippedRelu(accumulator.values[whiteToMove], transformed, NNUE_L1);
+    kernels.clippedRelu(accumulator.values[not whiteToMove], transformed + NNUE_L1, NNUE_L1);
+
+    alignas(64) int32_t hidden1[NNUE_L2];
+    alignas(64) uint8_t hidden1Output[NNUE_L2];
+    kernels.affine(transformed, 2 * NNUE_L1, m_hidden1Weights, m_hidden1Biases, hidden1, NNUE_L2);
+    activate(hidden1, hidden1Output, NNUE_L2);
+
+    alignas(64) int32_t hidden2[NNUE_L3];
+    alignas(64) uint8_t hidden2Output[NNUE_L3];
+    kernels.affine(hidden1Output, NNUE_L2, m_hidden2Weights, m_hidden2Biases, hidden2, NNUE_L3);
+    activate(hidden2, hidden2Output, NNUE_L3);
+
+    int32_t output;
+    kernels.affine(hidden2Output, NNUE_L3, m_outputWeights, m_outputBias, &output, 1);
+
+    return std::clamp(output / NNUE_OUTPUT_SCALE, -NNUE_MAX_SCORE, NNUE_MAX_SCORE);
+}
+
+/** Write a network with random weights, no trained network ships with the engine so tests and benchmarks use these
+ *
+ * @param path Path of the file to write
+ * @param seed Seed of the weights
+ */
+void Network::writeRandom(const std::string &path, const uint64_t seed) noexcept(false)
+{
+    std::vector<char> bytes(getFileSize(), 0);
+    std::memcpy(bytes.data(), NNUE_MAGIC, sizeof(NNUE_MAGIC));
+    std::memcpy(bytes.data() + sizeof(NNUE_MAGIC), &NNUE_VERSION, sizeof(NNUE_VERSION));
+
+    std::mt19937_64 random(seed);
+    const auto fill = [&]<typename T>(const size_t offset, const size_t count, const int low, const int high)
+    {
+        std::uniform_int_distribution distribution(low, high);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const T value = static_cast<T>(distribution(random));
+            std::memcpy(bytes.data() + offset + i * sizeof(T), &value, sizeof(T));
+        }
+    };
+
+    fill.operator()<int16_t>(NetworkLayout::FEATURE_BIASES, NNUE_L1, -32, 32);
+    fill.operator()<int16_t>(NetworkLayout::FEATURE_WEIGHTS, static_cast<size_t>(NNUE_FEATURES) * NNUE_L1, -32, 32);
+    fill.operator()<int32_t>(NetworkLayout::HIDDEN1_BIASES, NNUE_L2, -2000, 2000);
+    fill.operator()<int8_t>(NetworkLayout::HIDDEN1_WEIGHTS, NNUE_L2 * 2 * NNUE_L1, -16, 16);
+    fill.operator()<int32_t>(NetworkLayout::HIDDEN2_BIASES, NNUE_L3, -2000, 2000);
+    fill.operator()<int8_t>(NetworkLayout::HIDDEN2_WEIGHTS, NNUE_L3 * NNUE_L2, -64, 64);
+    fill.operator()<int32_t>(NetworkLayout::OUTPUT_BIAS, 1, -200, 200);
+    fill.operator()<int8_t>(NetworkLayout::OUTPUT_WEIGHTS, NNUE_L3, -127, 127);
+
+    std::ofstream file(path, std::ios::binary);
+    if (not file.write(bytes.data(), static_cast<std::streamsize>(bytes.size())))
+    {
+        throw ChessError("Unable to write network file " + path);
+    }
+}
+
+size_t Network::getFileSize() { return NetworkLayout::FILE_SIZE; }
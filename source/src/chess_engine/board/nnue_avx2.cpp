@@ -0,0 +1,94 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * nnue_avx2.cpp - AVX2 NNUE kernels
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/nnue_kernels.h"
+
+#include <immintrin.h>
+
+using namespace chessengine::board;
+
+namespace
+{
+
+void addRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; i += 16)
+    {
+        auto *values = reinterpret_cast<__m256i *>(accumulator + i);
+        const __m256i weights = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + i));
+        _mm256_storeu_si256(values, _mm256_add_epi16(_mm256_loadu_si256(values), weights));
+    }
+}
+
+void subRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; i += 16)
+    {
+        auto *values = reinterpret_cast<__m256i *>(accumulator + i);
+        const __m256i weights = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + i));
+        _mm256_storeu_si256(values, _mm256_sub_epi16(_mm256_loadu_si256(values), weights));
+    }
+}
+
+void clippedRelu(const int16_t *input, uint8_t *output, const unsigned size)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    for (unsigned i = 0; i < size; i += 32)
+    {
+        const __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+        const __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i + 16));
+        // Packing works per 128 bit lane, the permute puts the quarters back in order
+        const __m256i packed = _mm256_max_epi8(_mm256_packs_epi16(low, high), zero);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i),
+                            _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+}
+
+void affine(const uint8_t *input, const unsigned inputSize, const int8_t *weights, const int32_t *biases,
+            int32_t *output, const unsigned outputSize)
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    for (unsigned j = 0; j < outputSize; ++j)
+    {
+        const int8_t *row = weights + j * inputSize;
+        __m256i sum = _mm256_setzero_si256();
+        for (unsigned i = 0; i < inputSize; i += 32)
+        {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+            const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + i));
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(in, w), ones));
+        }
+
+        __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+        output[j] = biases[j] + _mm_cvtsi128_si32(half);
+    }
+}
+
+} // namespace
+
+const NnueKernels chessengine::board::AVX2_KERNELS = {"avx2", addRow, subRow, clippedRelu, affine};
@@ -0,0 +1,92 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * nnue_avx512.cpp - AVX-512 NNUE kernels
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/nnue_kernels.h"
+
+#include <immintrin.h>
+
+using namespace chessengine::board;
+
+namespace
+{
+
+void addRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; i += 32)
+    {
+        const __m512i values = _mm512_loadu_si512(accumulator + i);
+        _mm512_storeu_si512(accumulator + i, _mm512_add_epi16(values, _mm512_loadu_si512(row + i)));
+    }
+}
+
+void subRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; i += 32)
+    {
+        const __m512i values = _mm512_loadu_si512(accumulator + i);
+        _mm512_storeu_si512(accumulator + i, _mm512_sub_epi16(values, _mm512_loadu_si512(row + i)));
+    }
+}
+
+void clippedRelu(const int16_t *input, uint8_t *output, const unsigned size)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    for (unsigned i = 0; i < size; i += 32)
+    {
+        // Narrowing keeps the order, unlike packing
+        const __m256i narrowed = _mm512_cvtsepi16_epi8(_mm512_loadu_si512(input + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i), _mm256_max_epi8(narrowed, zero));
+    }
+}
+
+void affine(const uint8_t *input, const unsigned inputSize, const int8_t *weights, const int32_t *biases,
+            int32_t *output, const unsigned outputSize)
+{
+    // Layers narrower than a register run 256 bits at a time
+    if (inputSize % 64 != 0)
+    {
+        AVX2_KERNELS.affine(input, inputSize, weights, biases, output, outputSize);
+        return;
+    }
+
+    const __m512i ones = _mm512_set1_epi16(1);
+    for (unsigned j = 0; j < outputSize; ++j)
+    {
+        const int8_t *row = weights + j * inputSize;
+        __m512i sum = _mm512_setzero_si512();
+        for (unsigned i = 0; i < inputSize; i += 64)
+        {
+            const __m512i in = _mm512_loadu_si512(input + i);
+            const __m512i w = _mm512_loadu_si512(row + i);
+            sum = _mm512_add_epi32(sum, _mm512_madd_epi16(_mm512_maddubs_epi16(in, w), ones));
+        }
+        output[j] = biases[j] + _mm512_reduce_add_epi32(sum);
+    }
+}
+
+} // namespace
+
+const NnueKernels chessengine::board::AVX512_KERNELS = {"avx512", addRow, subRow, clippedRelu, affine};
@@ -0,0 +1,74 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * nnue_scalar.cpp - Portable NNUE kernels
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/nnue_kernels.h"
+
+using namespace chessengine::board;
+
+namespace
+{
+
+void addRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; ++i)
+    {
+        accumulator[i] = static_cast<int16_t>(accumulator[i] + row[i]);
+    }
+}
+
+void subRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; ++i)
+    {
+        accumulator[i] = static_cast<int16_t>(accumulator[i] - row[i]);
+    }
+}
+
+void clippedRelu(const int16_t *input, uint8_t *output, const unsigned size)
+{
+    for (unsigned i = 0; i < size; ++i)
+    {
+        output[i] = static_cast<uint8_t>(input[i] < 0 ? 0 : input[i] > 127 ? 127 : input[i]);
+    }
+}
+
+void affine(const uint8_t *input, const unsigned inputSize, const int8_t *weights, const int32_t *biases,
+            int32_t *output, const unsigned outputSize)
+{
+    for (unsigned j = 0; j < outputSize; ++j)
+    {
+        int32_t sum = biases[j];
+        for (unsigned i = 0; i < inputSize; ++i)
+        {
+            sum += input[i] * weights[j * inputSize + i];
+        }
+        output[j] = sum;
+    }
+}
+
+} // namespace
+
+const NnueKernels chessengine::board::SCALAR_KERNELS = {"scalar", addRow, subRow, clippedRelu, affine};
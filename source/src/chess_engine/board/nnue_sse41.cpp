@@ -0,0 +1,92 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * nnue_sse41.cpp - SSE4.1 NNUE kernels
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/nnue_kernels.h"
+
+#include <immintrin.h>
+
+using namespace chessengine::board;
+
+namespace
+{
+
+void addRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; i += 8)
+    {
+        auto *values = reinterpret_cast<__m128i *>(accumulator + i);
+        const __m128i weights = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i));
+        _mm_storeu_si128(values, _mm_add_epi16(_mm_loadu_si128(values), weights));
+    }
+}
+
+void subRow(int16_t *accumulator, const int16_t *row)
+{
+    for (unsigned i = 0; i < NNUE_L1; i += 8)
+    {
+        auto *values = reinterpret_cast<__m128i *>(accumulator + i);
+        const __m128i weights = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i));
+        _mm_storeu_si128(values, _mm_sub_epi16(_mm_loadu_si128(values), weights));
+    }
+}
+
+void clippedRelu(const int16_t *input, uint8_t *output, const unsigned size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    for (unsigned i = 0; i < size; i += 16)
+    {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i + 8));
+        // Saturating to int8 clamps at 127, max clamps at 0
+        const __m128i packed = _mm_max_epi8(_mm_packs_epi16(low, high), zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), packed);
+    }
+}
+
+void affine(const uint8_t *input, const unsigned inputSize, const int8_t *weights, const int32_t *biases,
+            int32_t *output, const unsigned outputSize)
+{
+    const __m128i ones = _mm_set1_epi16(1);
+    for (unsigned j = 0; j < outputSize; ++j)
+    {
+        const int8_t *row = weights + j * inputSize;
+        __m128i sum = _mm_setzero_si128();
+        for (unsigned i = 0; i < inputSize; i += 16)
+        {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+            const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + i));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(in, w), ones));
+        }
+
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+        output[j] = biases[j] + _mm_cvtsi128_si32(sum);
+    }
+}
+
+} // namespace
+
+const NnueKernels chessengine::board::SSE41_KERNELS = {"sse4.1", addRow, subRow, clippedRelu, affine};
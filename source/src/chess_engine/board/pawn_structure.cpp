@@ -0,0 +1,206 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * pawn_structure.cpp - Pawn structure evaluation and its hash table
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/pawn_structure.h"
+#include "chess_engine/board/bitboard.h"
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/piece.h"
+
+#include <algorithm>
+#include <bit>
+
+using namespace chessengine::board;
+
+namespace
+{
+
+/* Square 0 is h1, so shifting up by one moves a square towards the a file */
+constexpr uint64_t FILE_H = 0x0101010101010101ull;
+constexpr uint64_t FILE_A = FILE_H << 7;
+
+constexpr uint64_t shiftTowardsA(const uint64_t bitboard) { return bitboard << 1 & ~FILE_H; }
+constexpr uint64_t shiftTowardsH(const uint64_t bitboard) { return bitboard >> 1 & ~FILE_A; }
+
+constexpr uint64_t fillNorth(uint64_t bitboard)
+{
+    bitboard |= bitboard << 8;
+    bitboard |= bitboard << 16;
+    bitboard |= bitboard << 32;
+    return bitboard;
+}
+
+constexpr uint64_t fillSouth(uint64_t bitboard)
+{
+    bitboard |= bitboard >> 8;
+    bitboard |= bitboard >> 16;
+    bitboard |= bitboard >> 32;
+    return bitboard;
+}
+
+/* Attacks of pawns moving north, black pawns are handled by flipping the board */
+constexpr uint64_t getNorthPawnAttacks(const uint64_t pawns) { return shiftTowardsA(pawns << 8) | shiftTowardsH(pawns << 8); }
+constexpr uint64_t getSouthPawnAttacks(const uint64_t pawns) { return shiftTowardsA(pawns >> 8) | shiftTowardsH(pawns >> 8); }
+
+/** Flip a bitboard vertically so black's pawns move north */
+constexpr uint64_t flip(const uint64_t bitboard) { return std::byteswap(bitboard); }
+
+Score multiply(const Score &score, const int count) { return {score.mg * count, score.eg * count}; }
+
+/** Score the pawns of one side, with the board oriented so they move north
+ *
+ * @param own Pawns to score
+ * @param enemy Enemy pawns
+ * @param passed Set to the passed pawns
+ * @param attackSpan Set to every square the pawns attack now or after pushing
+ * @return Score of the pawns
+ */
+Score evaluateSide(const uint64_t own, const uint64_t enemy, uint64_t &passed, uint64_t &attackSpan)
+{
+    const uint64_t ownAttacks = getNorthPawnAttacks(own);
+    const uint64_t enemyAttacks = getSouthPawnAttacks(enemy);
+    attackSpan = fillNorth(ownAttacks);
+
+    // Enemy pawns stop a pawn by standing in front of it or attacking a square it has to cross
+    const uint64_t enemyFrontSpans = fillSouth(enemy >> 8);
+    const uint64_t enemyAttackSpans = fillSouth(enemyAttacks);
+    passed = own & ~(enemyFrontSpans | enemyAttackSpans);
+
+    const uint64_t files = fillNorth(fillSouth(own));
+    const uint64_t isolated = own & ~(shiftTowardsA(files) | shiftTowardsH(files));
+    const uint64_t doubled = own & fillNorth(own << 8);
+
+    // The stop square is attacked and no pawn behind on a neighbouring file can come to defend it
+    const uint64_t backward = own & ~isolated & (enemyAttacks & ~attackSpan) >> 8;
+
+    Score score = multiply(ISOLATED_PAWN, std::popcount(isolated)) + multiply(DOUBLED_PAWN, std::popcount(doubled)) +
+                  multiply(BACKWARD_PAWN, std::popcount(backward));
+    for (const int square: Bitboard(passed))
+    {
+        score += PASSED_PAWN[square / 8];
+    }
+
+    return score;
+}
+
+/** Score the pawns in front of a king, with the board oriented so they move north
+ *
+ * @param pawns Pawns of the king's side
+ * @param kingSquare Square of the king
+ */
+Score evaluateShield(const uint64_t pawns, const unsigned kingSquare)
+{
+    const uint64_t king = 1ull << kingSquare;
+    const uint64_t files = king | shiftTowardsA(king) | shiftTowardsH(king);
+
+    return multiply(PAWN_SHIELD[0], std::popcount(pawns & files << 8)) +
+           multiply(PAWN_SHIELD[1], std::popcount(pawns & files << 16));
+}
+
+} // namespace
+
+/** Create a table with room for a number of pawn structures
+ *
+ * @param entries Number of entries, rounded up to a power of two
+ */
+PawnTable::PawnTable(const size_t entries) : m_entries(std::bit_ceil(std::max<size_t>(entries, 1))) {}
+
+/** Find the entry of a board's pawn structure, computing it when the table doesn't have it
+ *
+ * @param board Board to look up
+ * @return Entry of the pawn structure, valid until the next probe
+ */
+PawnEntry &PawnTable::probe(const ChessBoard &board)
+{
+    ++m_probes;
+    PawnEntry &entry = m_entries[board.pawnKey & (m_entries.size() - 1)];
+    if (entry.key == board.pawnKey)
+    {
+        ++m_hits;
+        return entry;
+    }
+
+    computePawnEntry(board, entry);
+    return entry;
+}
+
+/** Forget every pawn structure */
+void PawnTable::clear()
+{
+    std::fill(m_entries.begin(), m_entries.end(), PawnEntry{});
+    m_probes = 0;
+    m_hits = 0;
+}
+
+/** Compute the pawn structure terms of a board from scratch
+ *
+ * @param board Board to look at
+ * @param entry Entry to fill in
+ */
+void chessengine::board::computePawnEntry(const ChessBoard &board, PawnEntry &entry)
+{
+    const uint64_t white = board.board.data[WHITE_PAWN].value;
+    const uint64_t black = board.board.data[BLACK_PAWN].value;
+
+    entry = PawnEntry{};
+    entry.key = board.pawnKey;
+
+    uint64_t passed;
+    uint64_t attackSpan;
+    entry.score = evaluateSide(white, black, passed, attackSpan);
+    entry.passedPawns[WHITE] = passed;
+    entry.attackSpans[WHITE] = attackSpan;
+
+    entry.score -= evaluateSide(flip(black), flip(white), passed, attackSpan);
+    entry.passedPawns[BLACK] = flip(passed);
+    entry.attackSpans[BLACK] = flip(attackSpan);
+}
+
+/** Get the pawn structure score of a board, king shields included
+ *
+ * @param board Board to score
+ * @param pawnTable Table of the thread doing the evaluation
+ * @return Score from white's point of view
+ */
+Score chessengine::board::evaluatePawns(const ChessBoard &board, PawnTable &pawnTable)
+{
+    PawnEntry &entry = pawnTable.probe(board);
+
+    const unsigned whiteKing = board.board.data[WHITE_KING].getLsb();
+    if (entry.kingSquares[WHITE] != whiteKing)
+    {
+        entry.kingSquares[WHITE] = static_cast<uint8_t>(whiteKing);
+        entry.shields[WHITE] = evaluateShield(board.board.data[WHITE_PAWN].value, whiteKing);
+    }
+
+    const unsigned blackKing = board.board.data[BLACK_KING].getLsb();
+    if (entry.kingSquares[BLACK] != blackKing)
+    {
+        entry.kingSquares[BLACK] = static_cast<uint8_t>(blackKing);
+        entry.shields[BLACK] = evaluateShield(flip(board.board.data[BLACK_PAWN].value), blackKing ^ 56);
+    }
+
+    return entry.score + entry.shields[WHITE] - entry.shields[BLACK];
+}
@@ -0,0 +1,114 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * piece.cpp - Dispatch from a piece value to the move generation of its type
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/piece.h"
+#include "chess_engine/board/bishop.h"
+#include "chess_engine/board/king.h"
+#include "chess_engine/board/knight.h"
+#include "chess_engine/board/pawn.h"
+#include "chess_engine/board/queen.h"
+#include "chess_engine/board/rook.h"
+
+#include <type_traits>
+
+using namespace chessengine::board;
+
+namespace
+{
+
+/** Call a member template of the piece's type with the piece's color
+ *
+ * @param piece Piece to dispatch on
+ * @param function Called with a default constructed piece type and the color as a constant
+ * @return What the function returns
+ */
+template<typename Function>
+uint64_t dispatch(PieceLoc piece, Function function)
+{
+    switch (piece)
+    {
+        case WHITE_PAWN:
+            return function(Pawn{}, std::true_type{});
+        case WHITE_KNIGHT:
+            return function(Knight{}, std::true_type{});
+        case WHITE_BISHOP:
+            return function(Bishop{}, std::true_type{});
+        case WHITE_ROOK:
+            return function(Rook{}, std::true_type{});
+        case WHITE_QUEEN:
+            return function(Queen{}, std::true_type{});
+        case WHITE_KING:
+            return function(King{}, std::true_type{});
+        case BLACK_PAWN:
+            return function(Pawn{}, std::false_type{});
+        case BLACK_KNIGHT:
+            return function(Knight{}, std::false_type{});
+        case BLACK_BISHOP:
+            return function(Bishop{}, std::false_type{});
+        case BLACK_ROOK:
+            return function(Rook{}, std::false_type{});
+        case BLACK_QUEEN:
+            return function(Queen{}, std::false_type{});
+        case BLACK_KING:
+            return function(King{}, std::false_type{});
+        default:
+            return 0;
+    }
+}
+
+} // namespace
+
+/** Get the possible attacks for the piece
+ *
+ * @param attacks Pointer to a 64-bit integer to store the legal attacks
+ */
+void Piece::getAttacks(uint64_t &attacks) const
+{
+    SL_ASSERT_TRUE(m_board, "Error: Board is null");
+
+    const uint64_t occupied = m_board->board.allPieces.value;
+    attacks |= withSliderBackend([&]<SliderBackend Backend>() {
+        return dispatch(m_piece, [&](auto type, auto color) {
+            return decltype(type)::template getAttacks<decltype(color)::value, Backend>(m_location, occupied);
+        });
+    });
+}
+
+/** Get the legal moves for the piece
+ *
+ * @param moves Pointer to a 64-bit integer to store the legal moves
+ */
+void Piece::getLegalMoves(uint64_t &moves) const
+{
+    SL_ASSERT_TRUE(m_board, "Error: Board is null");
+    SL_ASSERT_TRUE(m_board->board.genMoveInfo, "Error: Move info not generated, cannot generate legal moves");
+
+    moves |= withSliderBackend([&]<SliderBackend Backend>() {
+        return dispatch(m_piece, [&](auto type, auto color) {
+            return decltype(type)::template getLegalMoves<decltype(color)::value, Backend>(*m_board, m_location);
+        });
+    });
+}
@@ -0,0 +1,162 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * see.cpp - Static exchange evaluation
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/board/see.h"
+#include "chess_engine/board/attack_tables.h"
+
+using namespace chessengine::board;
+
+namespace
+{
+
+/** Play out the recaptures on a square after the first capture
+ *
+ * @param pieces Pieces on the board before the first capture
+ * @param to Square the exchange happens on
+ * @param occupied Occupancy after the first capture
+ * @param swap Material the first capture has to win back from the recaptures
+ * @param color Side that made the first capture, true for white
+ * @return True if the side that made the first capture comes out ahead
+ */
+template<SliderBackend Backend>
+bool playExchange(const Board &pieces, unsigned to, uint64_t occupied, int swap, bool color)
+{
+    const uint64_t diagonal = pieces.data[WHITE_BISHOP].value | pieces.data[WHITE_QUEEN].value |
+                              pieces.data[BLACK_BISHOP].value | pieces.data[BLACK_QUEEN].value;
+    const uint64_t straight = pieces.data[WHITE_ROOK].value | pieces.data[WHITE_QUEEN].value |
+                              pieces.data[BLACK_ROOK].value | pieces.data[BLACK_QUEEN].value;
+
+    uint64_t attackers = pieces.getAttackersTo<Backend>(to, occupied);
+
+    // Whether the side that made the move comes out ahead if the exchange stops now
+    bool result = true;
+    while (true)
+    {
+        color = !color;
+        attackers &= occupied;
+
+        const uint64_t ownAttackers = attackers & (color ? pieces.whitePieces : pieces.blackPieces).value;
+        if (!ownAttackers)
+        {
+            break;
+        }
+
+        result = !result;
+
+        // Capture with the least valuable attacker
+        const int own = color ? 0 : 6; // Black pieces are stored after the white pieces
+        int type = WHITE_PAWN;
+        while (!(ownAttackers & pieces.data[type + own].value))
+        {
+            ++type;
+        }
+
+        if (type == WHITE_KING)
+        {
+            // The king may only capture when the other side has no attackers left
+            return attackers & ~(color ? pieces.whitePieces : pieces.blackPieces).value ? !result : result;
+        }
+
+        swap = SEE_VALUES[type] - swap;
+        if (swap < static_cast<int>(result))
+        {
+            break;
+        }
+
+        occupied ^= 1ull << std::countr_zero(ownAttackers & pieces.data[type + own].value);
+
+        // Look for sliders behind the capturing piece
+        if (type == WHITE_PAWN or type == WHITE_BISHOP or type == WHITE_QUEEN)
+        {
+            attackers |= getBishopAttacks<Backend>(to, occupied) & diagonal;
+        }
+
+        if (type == WHITE_ROOK or type == WHITE_QUEEN)
+        {
+            attackers |= getRookAttacks<Backend>(to, occupied) & straight;
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+/** Check whether a move wins at least some material once every capture on its target square is played out
+ *
+ * Both sides recapture on the target square with their least valuable attacker and may stop
+ * whenever continuing would lose material. Sliders behind a capturing piece join in once the
+ * piece has moved away. Nothing is moved on the board, the exchange is played on a copy of the
+ * occupancy only. Pins are ignored.
+ *
+ * @param board Board the move is made on, the side to move makes the move
+ * @param move The move to look at
+ * @param threshold Material the move has to win at least, in centipawns
+ * @return True if the exchange wins at least threshold for the side making the move
+ */
+bool chessengine::board::see(const ChessBoard &board, Move move, int threshold)
+{
+    // Castling can't lose material and promotions are left to the search
+    if (move.isCastle() or move.isPromotion())
+    {
+        return 0 >= threshold;
+    }
+
+    const Board &pieces = board.board;
+    const unsigned from = move.getFrom();
+    const unsigned to = move.getTo();
+
+    uint64_t occupied = pieces.allPieces.value ^ 1ull << from ^ 1ull << to;
+    int captured = 0;
+    if (move.getFlags() == EN_PASSANT)
+    {
+        captured = SEE_VALUES[WHITE_PAWN];
+        occupied ^= 1ull << (board.whiteToMove ? to - 8 : to + 8);
+    }
+    else if (pieces.getPieceAt(to) != NO_PIECE)
+    {
+        captured = SEE_VALUES[pieces.getPieceAt(to) % 6];
+    }
+
+    // Winning the captured piece isn't enough
+    int swap = captured - threshold;
+    if (swap < 0)
+    {
+        return false;
+    }
+
+    // Even losing the moving piece afterwards is enough
+    swap = SEE_VALUES[pieces.getPieceAt(from) % 6] - swap;
+    if (swap <= 0)
+    {
+        return true;
+    }
+
+    // Only the recaptures look up slider attacks, so the backend is picked once for all of them
+    return withSliderBackend([&]<SliderBackend Backend>() {
+        return playExchange<Backend>(pieces, to, occupied, swap, board.whiteToMove);
+    });
+}
@@ -20,7 +20,169 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  *
- * chess_engine.cpp - <Brief description>
+ * chess_engine.cpp - The engine that searches the games
  * @author Matthew Brown
  * @date 05/27/2024
  *****************************************************************************/
+#include "chess_engine/chess_engine.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace chessengine;
+
+/** Stop and wait for a search started with startSearch */
+ChessEngine::~ChessEngine()
+{
+    stop();
+    wait();
+}
+
+/** Change the size of the transposition table, this clears it
+ *
+ * @param megabytes New size in megabytes
+ */
+void ChessEngine::setHashSize(size_t megabytes) { m_transpositionTable.resize(megabytes); }
+
+/** Change the number of threads used by every following search
+ *
+ * @param threads Number of threads, at least one
+ */
+void ChessEngine::setThreadCount(unsigned threads) { m_threadCount = std::max(threads, 1u); }
+
+/** Change the selective search techniques used by every following search
+ *
+ * @param options Techniques to turn on or off
+ */
+void ChessEngine::setSearchOptions(const SearchOptions &options) { m_searchOptions = options; }
+
+/** Evaluate with a network in every following search instead of the piece-square tables
+ *
+ * The old network stays in use if the new one can't be loaded.
+ *
+ * @param path Path of the network file
+ */
+void ChessEngine::loadNetwork(const std::string &path) noexcept(false)
+{
+    m_network = std::make_unique<board::Network>(path);
+}
+
+/** Forget everything learned from the previous game */
+void ChessEngine::newGame() { m_transpositionTable.clear(); }
+
+/** Search a position for the best move
+ *
+ * Blocks until the search reaches its limits or stop is called from another thread.
+ * With more than one thread the helpers run a Lazy SMP search of the same position next
+ * to the main thread, the best move and the reports come from the main thread and the
+ * node counts include every thread.
+ *
+ * @param game Game to search, it is not changed. Searched with the engine's network if one is loaded
+ * @param limits When to stop searching
+ * @param onIteration Called with the result of every finished iteration
+ * @return Best move and information of the last finished iteration
+ */
+SearchResult ChessEngine::search(const ChessGame &game, const SearchLimits &limits, const SearchCallback &onIteration)
+{
+    m_stop.store(false);
+    return runSearch(game, limits, onIteration);
+}
+
+/** Search a position on a thread of its own, returning right away
+ *
+ * The game and limits are copied, so they can change while the search runs. A search that is
+ * still running is waited for first. stop ends the search and wait waits for it to finish.
+ * Both callbacks are called from the search thread.
+ *
+ * @param game Game to search
+ * @param limits When to stop searching
+ * @param onIteration Called with the result of every finished iteration
+ * @param onFinish Called with the result once the search is done
+ */
+void ChessEngine::startSearch(const ChessGame &game, const SearchLimits &limits, SearchCallback onIteration,
+                              std::function<void(const SearchResult &)> onFinish)
+{
+    wait();
+
+    // Cleared here rather than on the search thread, so a stop right after this call is never lost
+    m_stop.store(false);
+    m_searchThread = std::jthread(
+            [this, game, limits, onIteration = std::move(onIteration), onFinish = std::move(onFinish)]
+            {
+                const SearchResult result = runSearch(game, limits, onIteration);
+                if (onFinish)
+                {
+                    onFinish(result);
+                }
+            });
+}
+
+/** Wait for a search started with startSearch to finish */
+void ChessEngine::wait()
+{
+    if (m_searchThread.joinable())
+    {
+        m_searchThread.join();
+    }
+}
+
+/** Run the searches of every thread, the stop flag must already be cleared */
+SearchResult ChessEngine::runSearch(const ChessGame &game, const SearchLimits &limits,
+                                    const SearchCallback &onIteration)
+{
+    m_transpositionTable.newSearch();
+
+    ChessGame root = game;
+    if (m_network != nullptr)
+    {
+        root.setNetwork(m_network.get());
+    }
+
+    // The PV tables are too big to keep on the stack
+    std::vector<std::unique_ptr<Search>> searches;
+    for (unsigned j = 0; j < m_threadCount; ++j)
+    {
+        searches.push_back(std::make_unique<Search>(root, m_transpositionTable, m_stop, j, m_searchOptions));
+    }
+
+    const auto getTotalNodes = [&searches]
+    {
+        uint64_t nodes = 0;
+        for (const auto &search: searches)
+        {
+            nodes += search->getNodes();
+        }
+
+        return nodes;
+    };
+
+    SearchResult result;
+    {
+        std::vector<std::jthread> helpers;
+        for (unsigned j = 1; j < m_threadCount; ++j)
+        {
+            helpers.emplace_back([&limits, search = searches[j].get()] { search->run(limits); });
+        }
+
+        result = searches[0]->run(limits,
+                                  [&](const SearchInfo &info)
+                                  {
+                                      if (onIteration)
+                                      {
+                                          SearchInfo total = info;
+                                          total.nodes = getTotalNodes();
+                                          onIteration(total);
+                                      }
+                                  });
+
+        // The main thread raised the stop flag when it finished, the helpers are joined here
+    }
+
+    result.info.nodes = getTotalNodes();
+    return result;
+}
+
+/** Stop a running search, it returns the best move found so far */
+void ChessEngine::stop() { m_stop.store(true); }
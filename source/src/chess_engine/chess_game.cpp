@@ -26,12 +26,17 @@
  *****************************************************************************/
 #include "chess_engine/chess_game.h"
 
+#include "chess_engine/board/attack_tables.h"
 #include "chess_engine/board/bishop.h"
 #include "chess_engine/board/king.h"
 #include "chess_engine/board/knight.h"
 #include "chess_engine/board/pawn.h"
 #include "chess_engine/board/queen.h"
 #include "chess_engine/board/rook.h"
+#include "chess_engine/board/zobrist.h"
+#include "chess_engine/chess_error.h"
+
+#include <algorithm>
 
 using namespace chessengine;
 
@@ -42,62 +47,104 @@ using namespace chessengine;
  *
  * @return The number of pieces in the game
  */
-uint64_t ChessGame::getPieceCount() const { return m_pieceInformation.size(); }
+uint64_t ChessGame::getPieceCount() const { return m_board.board.allPieces.getBitCount(); }
 
 /** Get the pieces in the game
  *
  * @return The pieces in the game
  */
-std::vector<board::Piece *> ChessGame::getPieces() const { return m_pieceInformation; }
+std::vector<board::Piece> ChessGame::getPieces() const
+{
+    std::vector<board::Piece> pieces;
+    for (const int square: m_board.board.allPieces)
+    {
+        pieces.push_back(getPiece(square));
+    }
+
+    return pieces;
+}
 
 /** Get a piece from the game
  *
  * @param square The square of the piece
- * @return The piece at the square
+ * @return The piece at the square, not valid if the square is empty
  */
-board::Piece *ChessGame::getPiece(uint64_t square) const
+board::Piece ChessGame::getPiece(uint64_t square) const
 {
-    if (m_pieceInformation.empty())
+    if (square > 63)
     {
-        return nullptr;
+        return {};
     }
 
-    for (int j = 0; j < m_pieceInformation.size(); ++j)
+    return {m_board.board.getPieceAt(square), &m_board, static_cast<unsigned int>(square)};
+}
+
+namespace
+{
+
+/** Get every square attacked by one side from the lookup tables
+ *
+ * @param board Board to read the pieces from
+ * @param color Side to generate the attacks for
+ * @return Every square attacked by the side
+ */
+template<board::SliderBackend Backend>
+uint64_t getSideAttacks(const board::Board &board, bool color)
+{
+    using namespace board;
+
+    const int offset = color ? 0 : 6; // Black pieces are stored after the white pieces
+
+    // The enemy king is see-through, so it can't step back along the ray that checks it
+    const uint64_t occupied = board.allPieces.value & ~board.data[BLACK_KING - offset].value;
+    const uint64_t queens = board.data[WHITE_QUEEN + offset].value;
+    uint64_t attacks = 0;
+
+    for (const int square: board.data[WHITE_PAWN + offset])
     {
-        if (m_pieceInformation[j]->getSquare() == square)
-        {
-            return m_pieceInformation[j];
-        }
+        attacks |= getPawnAttacks(color, square);
+    }
+
+    for (const int square: board.data[WHITE_KNIGHT + offset])
+    {
+        attacks |= KNIGHT_ATTACKS[square];
+    }
+
+    for (const int square: Bitboard(board.data[WHITE_BISHOP + offset].value | queens))
+    {
+        attacks |= getBishopAttacks<Backend>(square, occupied);
     }
 
-    return nullptr;
+    for (const int square: Bitboard(board.data[WHITE_ROOK + offset].value | queens))
+    {
+        attacks |= getRookAttacks<Backend>(square, occupied);
+    }
+
+    for (const int square: board.data[WHITE_KING + offset])
+    {
+        attacks |= KING_ATTACKS[square];
+    }
+
+    return attacks;
 }
 
+} // namespace
+
 /** Generate all possible attacks for the black pieces */
 void ChessGame::generateBlackAttacks()
 {
-    m_board.board.blackAttacks = 0;
-    for (auto &piece: m_pieceInformation)
-    {
-        if (piece->getColor() == board::BLACK)
-        {
-            piece->getAttacks(m_board.board.blackAttacks.value);
-        }
-    }
+    m_board.board.blackAttacks = board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        return getSideAttacks<Backend>(m_board.board, board::BLACK);
+    });
 }
 
 
 /** Generate all possible attacks for the white pieces */
 void ChessGame::generateWhiteAttacks()
 {
-    m_board.board.whiteAttacks = 0;
-    for (auto &piece: m_pieceInformation)
-    {
-        if (piece->getColor() == board::WHITE)
-        {
-            piece->getAttacks(m_board.board.whiteAttacks.value);
-        }
-    }
+    m_board.board.whiteAttacks = board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        return getSideAttacks<Backend>(m_board.board, board::WHITE);
+    });
 }
 
 /** Generate necessary information for legal move generation
@@ -110,8 +157,13 @@ void ChessGame::pregenLegalMoves()
     m_board.board.getWhitePieces(m_board.board.whitePieces);
     m_board.board.getBlackPieces(m_board.board.blackPieces);
 
-    generateWhiteAttacks();
-    generateBlackAttacks();
+    board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        m_board.board.whiteAttacks = getSideAttacks<Backend>(m_board.board, board::WHITE);
+        m_board.board.blackAttacks = getSideAttacks<Backend>(m_board.board, board::BLACK);
+
+        m_board.board.generateCheckInfo<Backend>(board::WHITE);
+        m_board.board.generateCheckInfo<Backend>(board::BLACK);
+    });
 
     m_board.board.genMoveInfo = true;
 }
@@ -119,19 +171,21 @@ void ChessGame::pregenLegalMoves()
 namespace
 {
 
-/* Useful constants for castling */
+/* Useful constants for castling, squares the king crosses must not be attacked */
 
-uint64_t whiteKingSide = 0b000001110ull;
-uint64_t whiteQueenSide = 0b011111000ull;
+constexpr uint64_t whiteKingSide = 0b00001110ull;
+constexpr uint64_t whiteQueenSide = 0b00111000ull;
 
-uint64_t blackKingSide = whiteKingSide << 56;
-uint64_t blackQueenSide = whiteQueenSide << 56;
+constexpr uint64_t blackKingSide = whiteKingSide << 56;
+constexpr uint64_t blackQueenSide = whiteQueenSide << 56;
 
-uint64_t whiteKingSideInbetween = 0b000000110ull;
-uint64_t whiteQueenSideInbetween = 0b011110000ull;
+/* Squares between the king and rook that must be empty */
 
-uint64_t blackKingSideInbetween = whiteKingSideInbetween << 56;
-uint64_t blackQueenSideInbetween = whiteQueenSideInbetween << 56;
+constexpr uint64_t whiteKingSideInbetween = 0b00000110ull;
+constexpr uint64_t whiteQueenSideInbetween = 0b01110000ull;
+
+constexpr uint64_t blackKingSideInbetween = whiteKingSideInbetween << 56;
+constexpr uint64_t blackQueenSideInbetween = whiteQueenSideInbetween << 56;
 
 } // namespace
 
@@ -144,45 +198,28 @@ uint64_t blackQueenSideInbetween = whiteQueenSideInbetween << 56;
  */
 bool ChessGame::canCastle(board::CastleRights type)
 {
-    SL_ASSERT(m_board.board.blackAttacks.value != 0, "Black attacks are not generated");
-    SL_ASSERT(m_board.board.whiteAttacks.value != 0, "White attacks are not generated");
-    SL_ASSERT(m_board.board.getTotalValue().value != 0, "No pieces on the board");
+    SL_ASSERT_TRUE(m_board.board.genMoveInfo, "Error: Move info not generated, cannot check castling");
 
-    if (m_board.castlingRights[type])
+    if (!m_board.hasCastlingRight(type))
     {
         return false;
     }
 
+    const uint64_t occupied = m_board.board.allPieces.value;
     switch (type)
     {
         case board::CastleRights::WHITE_KINGSIDE:
-            if (!((m_board.board.blackAttacks.value & whiteKingSide) and
-                  (m_board.board.getTotalValue().value & whiteKingSideInbetween)))
-            {
-                return true;
-            }
-            break;
+            return !(m_board.board.blackAttacks.value & whiteKingSide) and !(occupied & whiteKingSideInbetween) and
+                   (m_board.board.data[board::WHITE_ROOK].value & 1ull);
         case board::CastleRights::WHITE_QUEENSIDE:
-            if (!((m_board.board.blackAttacks.value & whiteQueenSide) and
-                  (m_board.board.getTotalValue().value & whiteQueenSideInbetween)))
-            {
-                return true;
-            }
-            break;
+            return !(m_board.board.blackAttacks.value & whiteQueenSide) and !(occupied & whiteQueenSideInbetween) and
+                   (m_board.board.data[board::WHITE_ROOK].value & 1ull << 7);
         case board::CastleRights::BLACK_KINGSIDE:
-            if (!((m_board.board.whiteAttacks.value & blackKingSide) and
-                  (m_board.board.getTotalValue().value & blackQueenSideInbetween)))
-            {
-                return true;
-            }
-            break;
+            return !(m_board.board.whiteAttacks.value & blackKingSide) and !(occupied & blackKingSideInbetween) and
+                   (m_board.board.data[board::BLACK_ROOK].value & 1ull << 56);
         case board::CastleRights::BLACK_QUEENSIDE:
-            if (!((m_board.board.whiteAttacks.value & blackQueenSide) and
-                  (m_board.board.getTotalValue().value & blackQueenSideInbetween)))
-            {
-                return true;
-            }
-            break;
+            return !(m_board.board.whiteAttacks.value & blackQueenSide) and !(occupied & blackQueenSideInbetween) and
+                   (m_board.board.data[board::BLACK_ROOK].value & 1ull << 63);
     }
 
     return false;
@@ -197,131 +234,654 @@ bool ChessGame::canCastle(board::CastleRights type)
  * @param color The color of the side
  * @param castling Results are stored here
  */
-void ChessGame::canCastle(bool color, board::Bitboard &castling) {}
+void ChessGame::canCastle(bool color, board::Bitboard &castling)
+{
+    const unsigned kingSquare = color ? 3 : 59;
+    if (canCastle(color ? board::WHITE_KINGSIDE : board::BLACK_KINGSIDE))
+    {
+        castling.value |= 1ull << (kingSquare - 2);
+    }
 
-/** Get the white king
+    if (canCastle(color ? board::WHITE_QUEENSIDE : board::BLACK_QUEENSIDE))
+    {
+        castling.value |= 1ull << (kingSquare + 2);
+    }
+}
+
+namespace
+{
+
+/** Add a move to every target square, marking the captures
  *
- * @return A reference to the white king
+ * @param moves List to add the moves to
+ * @param from Starting square
+ * @param targets Target squares
+ * @param enemy Enemy pieces
  */
-board::Piece *ChessGame::getWhiteKing() const
+void addMoves(board::MoveList &moves, unsigned from, uint64_t targets, uint64_t enemy)
 {
-    if (m_pieceInformation.empty() or m_whiteKing == nullptr)
+    for (const int to: board::Bitboard(targets))
     {
-        return nullptr;
+        moves.add(from, to, enemy & 1ull << to ? board::CAPTURE : board::QUIET);
     }
+}
 
-    return m_whiteKing;
+/** Add the legal moves of every piece of one type
+ *
+ * @param moves List to add the moves to
+ * @param board Board to generate the moves on
+ * @param targets Squares the pieces may move to
+ */
+template<typename PieceT, bool Color, board::SliderBackend Backend>
+void addPieceMoves(board::MoveList &moves, const board::ChessBoard &board, uint64_t targets)
+{
+    const uint64_t enemy = board::getEnemyPieces<Color>(board);
+    for (const int from: board.board.data[PieceT::WHITE_LOCATION + (Color ? 0 : 6)])
+    {
+        addMoves(moves, from, PieceT::template getLegalMoves<Color, Backend>(board, from, targets), enemy);
+    }
 }
 
-/** Get the black king
+/** Get the flags of a pawn move that is not a promotion
  *
- * @return A reference to the black king
+ * @param board Board the pawn is on
+ * @param from Starting square
+ * @param to Target square
+ * @param enemy Enemy pieces
+ * @return CAPTURE, EN_PASSANT, DOUBLE_PAWN_PUSH or QUIET
  */
-board::Piece *ChessGame::getBlackKing() const
+unsigned getPawnMoveFlags(const board::ChessBoard &board, unsigned from, unsigned to, uint64_t enemy)
 {
-    if (m_pieceInformation.empty() or m_blackKing == nullptr)
+    using namespace board;
+
+    if (enemy & 1ull << to)
+    {
+        return CAPTURE;
+    }
+
+    if (to == board.enPassantSquare and (to - from) % 8 != 0)
     {
-        return nullptr;
+        return EN_PASSANT;
     }
 
-    return m_blackKing;
+    return to - from == 16 or from - to == 16 ? DOUBLE_PAWN_PUSH : QUIET;
 }
 
-/** Reset the board and piece information */
-void ChessGame::resetGame()
+/** Add the legal moves of every pawn, expanding promotions and marking double pushes and en passant
+ *
+ * @param moves List to add the moves to
+ * @param board Board to generate the moves on
+ * @param targets Squares the pawns may move to, en passant is added unless only quiet moves are generated
+ */
+template<bool Color, GenType Type, board::SliderBackend Backend>
+void addPawnMoves(board::MoveList &moves, const board::ChessBoard &board, uint64_t targets)
 {
-    m_board.resetBoard();
+    using namespace board;
 
-    if (!m_pieceInformation.empty())
+    const uint64_t enemy = getEnemyPieces<Color>(board);
+    for (const int from: board.board.data[Color ? WHITE_PAWN : BLACK_PAWN])
     {
-        for (auto &elem: m_pieceInformation)
+        for (const int to: Bitboard(Pawn::getLegalMoves<Color, Backend>(board, from, targets)))
         {
-            delete elem;
-            elem = nullptr;
+            if (to < 8 or to > 55)
+            {
+                const unsigned capture = enemy & 1ull << to ? CAPTURE : QUIET;
+                for (unsigned promotion = KNIGHT_PROMOTION; promotion <= QUEEN_PROMOTION; ++promotion)
+                {
+                    moves.add(from, to, promotion | capture);
+                }
+                continue;
+            }
+
+            const unsigned flags = getPawnMoveFlags(board, from, to, enemy);
+            if (Type != GEN_QUIETS or flags != EN_PASSANT)
+            {
+                moves.add(from, to, flags);
+            }
         }
+    }
+}
+
+} // namespace
+
+/** Generate every legal move for the side to move
+ *
+ * The occupancy bitboards must be up to date, the enemy attacks and check information
+ * for the side to move are generated here if the last move made them stale.
+ *
+ * @param moves List to fill, it is cleared first
+ */
+void ChessGame::generateLegalMoves(board::MoveList &moves)
+{
+    board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        m_board.whiteToMove ? generateMoves<board::WHITE, GEN_ALL, Backend>(moves)
+                            : generateMoves<board::BLACK, GEN_ALL, Backend>(moves);
+    });
+}
+
+/** Generate the legal captures and promotions for the side to move
+ *
+ * Only the target squares holding enemy pieces are looked at, plus the last rank for
+ * pawn pushes, so no quiet move is generated and thrown away.
+ *
+ * @param moves List to fill, it is cleared first
+ */
+void ChessGame::generateCaptures(board::MoveList &moves)
+{
+    board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        m_board.whiteToMove ? generateMoves<board::WHITE, GEN_CAPTURES, Backend>(moves)
+                            : generateMoves<board::BLACK, GEN_CAPTURES, Backend>(moves);
+    });
+}
+
+/** Generate the legal moves that are neither captures nor promotions for the side to move
+ *
+ * Together with generateCaptures this gives every legal move exactly once.
+ *
+ * @param moves List to fill, it is cleared first
+ */
+void ChessGame::generateQuiets(board::MoveList &moves)
+{
+    board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        m_board.whiteToMove ? generateMoves<board::WHITE, GEN_QUIETS, Backend>(moves)
+                            : generateMoves<board::BLACK, GEN_QUIETS, Backend>(moves);
+    });
+}
 
-        m_pieceInformation.clear();
+/** Check whether a move is legal for the side to move
+ *
+ * Meant for moves that were not generated in this position, like the move from the
+ * transposition table or a killer move, which is much cheaper than generating every move.
+ *
+ * @param move The move to check
+ * @return True if the move, including its flags, is one generateLegalMoves would give
+ */
+bool ChessGame::isLegal(board::Move move)
+{
+    return board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        return m_board.whiteToMove ? isLegal<board::WHITE, Backend>(move) : isLegal<board::BLACK, Backend>(move);
+    });
+}
+
+/** Generate the enemy attacks and check information for one side, unless they are still up to date */
+template<bool Color, board::SliderBackend Backend>
+void ChessGame::generateMoveInfo()
+{
+    if (m_board.board.genMoveInfo)
+    {
+        return;
     }
+
+    board::Bitboard &enemyAttacks = Color ? m_board.board.blackAttacks : m_board.board.whiteAttacks;
+    enemyAttacks = getSideAttacks<Backend>(m_board.board, !Color);
+    m_board.board.generateCheckInfo<Backend>(Color);
+    m_board.board.genMoveInfo = true;
 }
 
-/** Create a new game from a FEN string
+/** Generate the legal moves for one side
  *
- * @param fen The FEN string
+ * @param moves List to fill, it is cleared first
  */
-void ChessGame::createFromFEN(const std::string &fen) noexcept(false)
+template<bool Color, GenType Type, board::SliderBackend Backend>
+void ChessGame::generateMoves(board::MoveList &moves)
 {
-    resetGame();
+    using namespace board;
+
+    moves.clear();
+    generateMoveInfo<Color, Backend>();
 
-    m_board.createFromFEN(fen);
+    // Pushes to the last rank are promotions
+    constexpr uint64_t lastRank = Color ? 0xff00000000000000ull : 0xffull;
+    const uint64_t enemy = getEnemyPieces<Color>(m_board);
+    const uint64_t empty = ~m_board.board.allPieces.value;
+    const uint64_t targets = Type == GEN_ALL ? ~getOwnPieces<Color>(m_board) : Type == GEN_CAPTURES ? enemy : empty;
 
-    for (int j = 0; j < 12; ++j)
+    // The king can always move, even in double check
+    addPieceMoves<King, Color, Backend>(moves, m_board, targets);
+
+    const CheckInfo &info = m_board.board.getCheckInfo(Color);
+    if (info.checkers.getBitCount() > 1)
     {
-        for (int i = 0; i < 64; ++i)
+        return;
+    }
+
+    addPieceMoves<Knight, Color, Backend>(moves, m_board, targets);
+    addPieceMoves<Bishop, Color, Backend>(moves, m_board, targets);
+    addPieceMoves<Rook, Color, Backend>(moves, m_board, targets);
+    addPieceMoves<Queen, Color, Backend>(moves, m_board, targets);
+
+    const uint64_t pawnTargets = Type == GEN_ALL        ? targets
+                                 : Type == GEN_CAPTURES ? enemy | (lastRank & empty)
+                                                        : empty & ~lastRank;
+    addPawnMoves<Color, Type, Backend>(moves, m_board, pawnTargets);
+
+    if (Type != GEN_CAPTURES and info.checkers.isEmpty())
+    {
+        constexpr unsigned kingSquare = Color ? 3 : 59;
+        if (canCastle(Color ? WHITE_KINGSIDE : BLACK_KINGSIDE))
         {
-            int vsqr = i; // (i / 8) * 8 + (7 - i % 8);
-            int sqr = i;
+            moves.add(kingSquare, kingSquare - 2, KING_CASTLE);
+        }
 
-            if (m_board.board.data[j].value & 0b1ull << vsqr)
-            {
-                using namespace board;
-                switch (j)
-                {
-                    case 0: // First element is white pawns
-                        m_pieceInformation.push_back(new WhitePawn(&m_board, sqr));
-                        break;
-                    case 1: // Second element is white knights
-                        m_pieceInformation.push_back(new Knight(WHITE, &m_board, sqr));
-                        break;
-                    case 2: // Third element is white bishops
-                        m_pieceInformation.push_back(new Bishop(WHITE, &m_board, sqr));
-                        break;
-                    case 3: // Fourth element is white rooks
-                        m_pieceInformation.push_back(new Rook(WHITE, &m_board, sqr));
-                        break;
-                    case 4: // Fifth element is white queens
-                        m_pieceInformation.push_back(new Queen(WHITE, &m_board, sqr));
-                        break;
-                    case 5: // Sixth element is white king
-                        m_pieceInformation.push_back(new King(WHITE, &m_board, sqr));
-                        m_whiteKing = m_pieceInformation.back();
-                        break;
-                    case 6: // Seventh element is black pawns
-                        m_pieceInformation.push_back(new BlackPawn(&m_board, sqr));
-                        break;
-                    case 7: // Eighth element is black knights
-                        m_pieceInformation.push_back(new Knight(BLACK, &m_board, sqr));
-                        break;
-                    case 8: // Ninth element is black bishops
-                        m_pieceInformation.push_back(new Bishop(BLACK, &m_board, sqr));
-                        break;
-                    case 9: // Tenth element is black rooks
-                        m_pieceInformation.push_back(new Rook(BLACK, &m_board, sqr));
-                        break;
-                    case 10: // Eleventh element is black queens
-                        m_pieceInformation.push_back(new Queen(BLACK, &m_board, sqr));
-                        break;
-                    case 11: // Twelfth element is black king
-                        m_pieceInformation.push_back(new King(BLACK, &m_board, sqr));
-                        m_blackKing = m_pieceInformation.back();
-                        break;
-                    default:
-                        break; // This is impossible
-                }
-            }
+        if (canCastle(Color ? WHITE_QUEENSIDE : BLACK_QUEENSIDE))
+        {
+            moves.add(kingSquare, kingSquare + 2, QUEEN_CASTLE);
         }
     }
+}
+
+/** Check whether a move is legal for one side
+ *
+ * @param move The move to check
+ * @return True if the move is legal
+ */
+template<bool Color, board::SliderBackend Backend>
+bool ChessGame::isLegal(board::Move move)
+{
+    using namespace board;
 
-    if (m_whiteKing == nullptr or m_blackKing == nullptr)
+    if (move == NO_MOVE)
     {
-        throw std::runtime_error("Could not find kings in the FEN string");
-        return;
+        return false;
     }
 
-    for (auto &j: m_pieceInformation)
+    generateMoveInfo<Color, Backend>();
+
+    const unsigned from = move.getFrom();
+    const unsigned to = move.getTo();
+    const PieceLoc piece = m_board.board.getPieceAt(from);
+    constexpr int own = Color ? 0 : 6; // Black pieces are stored after the white pieces
+    if (piece == NO_PIECE or piece < own or piece >= own + 6)
     {
-        j->setKing(m_whiteKing);
-        j->setKing(m_blackKing);
+        return false;
     }
+
+    const CheckInfo &info = m_board.board.getCheckInfo(Color);
+    if (move.isCastle())
+    {
+        constexpr unsigned kingSquare = Color ? 3 : 59;
+        if (piece != WHITE_KING + own or from != kingSquare or !info.checkers.isEmpty())
+        {
+            return false;
+        }
+
+        return move.getFlags() == KING_CASTLE
+                   ? to == kingSquare - 2 and canCastle(Color ? WHITE_KINGSIDE : BLACK_KINGSIDE)
+                   : to == kingSquare + 2 and canCastle(Color ? WHITE_QUEENSIDE : BLACK_QUEENSIDE);
+    }
+
+    // Only the king can get out of a double check
+    if (piece != WHITE_KING + own and info.checkers.getBitCount() > 1)
+    {
+        return false;
+    }
+
+    uint64_t legal = 0;
+    switch (piece - own)
+    {
+        case WHITE_PAWN: legal = Pawn::getLegalMoves<Color, Backend>(m_board, from); break;
+        case WHITE_KNIGHT: legal = Knight::getLegalMoves<Color, Backend>(m_board, from); break;
+        case WHITE_BISHOP: legal = Bishop::getLegalMoves<Color, Backend>(m_board, from); break;
+        case WHITE_ROOK: legal = Rook::getLegalMoves<Color, Backend>(m_board, from); break;
+        case WHITE_QUEEN: legal = Queen::getLegalMoves<Color, Backend>(m_board, from); break;
+        default: legal = King::getLegalMoves<Color, Backend>(m_board, from); break;
+    }
+
+    if (!(legal & 1ull << to))
+    {
+        return false;
+    }
+
+    const uint64_t enemy = getEnemyPieces<Color>(m_board);
+    const unsigned capture = enemy & 1ull << to ? CAPTURE : QUIET;
+    if (piece != WHITE_PAWN + own)
+    {
+        return move.getFlags() == capture;
+    }
+
+    if (to < 8 or to > 55)
+    {
+        return move.isPromotion() and (move.getFlags() & CAPTURE) == capture;
+    }
+
+    return move.getFlags() == getPawnMoveFlags(m_board, from, to, enemy);
+}
+
+/** Make a move on the board
+ *
+ * Only the bitboards and game state are updated, everything the move changes is flipped with an XOR
+ * so unmakeMove can flip it back. The hash keys and the running evaluation are updated by the pieces
+ * that moved, unmakeMove restores them from the undo record. The move must be legal for the side to move.
+ *
+ * @param move The move to make
+ */
+void ChessGame::makeMove(board::Move move)
+{
+    using namespace board;
+
+    const PieceLoc piece = m_board.board.getPieceAt(move.getFrom());
+    SL_ASSERT_TRUE(piece != NO_PIECE, "Error: No piece to move");
+
+    MoveUndo &undo = m_moveHistory.emplace_back();
+    undo.hashKey = m_board.hashKey;
+    undo.pawnKey = m_board.pawnKey;
+    undo.materialKey = m_board.materialKey;
+    undo.psqtScore = m_board.psqtScore;
+    undo.phase = m_board.phase;
+    undo.move = move;
+    undo.enPassantSquare = m_board.enPassantSquare;
+    undo.halfMoveClock = m_halfMoveClock;
+    undo.castlingRights = m_board.castlingRights;
+
+    DirtyPieces dirty;
+    undo.captured = m_board.makeMove(move, dirty);
+
+    if (piece % 6 == WHITE_PAWN or move.isCapture())
+    {
+        m_halfMoveClock = 0;
+    }
+    else
+    {
+        ++m_halfMoveClock;
+    }
+
+    // Black just moved
+    if (m_board.whiteToMove)
+    {
+        ++m_fullMoveClock;
+    }
+
+    if (m_network != nullptr)
+    {
+        m_accumulators.emplace_back();
+        m_network->update(m_board, dirty, m_accumulators[m_accumulators.size() - 2], m_accumulators.back());
+    }
+}
+
+/** Take back the last move made with makeMove */
+void ChessGame::unmakeMove()
+{
+    using namespace board;
+
+    SL_ASSERT_TRUE(!m_moveHistory.empty(), "Error: No move to take back");
+
+    const MoveUndo undo = m_moveHistory.back();
+    m_moveHistory.pop_back();
+
+    Board &board = m_board.board;
+    const bool color = !m_board.whiteToMove;
+    const int own = color ? 0 : 6; // Black pieces are stored after the white pieces
+    Bitboard &ownPieces = color ? board.whitePieces : board.blackPieces;
+    Bitboard &enemyPieces = color ? board.blackPieces : board.whitePieces;
+
+    const Move move = undo.move;
+    const unsigned from = move.getFrom();
+    const unsigned to = move.getTo();
+    const uint64_t fromTo = 1ull << from | 1ull << to;
+
+    PieceLoc piece = board.getPieceAt(to);
+    if (move.isPromotion())
+    {
+        board.data[piece].value ^= 1ull << to;
+        piece = static_cast<PieceLoc>(WHITE_PAWN + own);
+        board.data[piece].value ^= 1ull << to;
+    }
+    else if (move.isCastle())
+    {
+        const uint64_t rookMove = getCastlingRookMove(move);
+        const auto rook = static_cast<PieceLoc>(WHITE_ROOK + own);
+        board.data[rook].value ^= rookMove;
+        ownPieces.value ^= rookMove;
+        board.allPieces.value ^= rookMove;
+
+        for (const int square: Bitboard(rookMove))
+        {
+            board.mailbox[square] = board.mailbox[square] == rook ? NO_PIECE : rook;
+        }
+    }
+
+    board.data[piece].value ^= fromTo;
+    ownPieces.value ^= fromTo;
+    board.allPieces.value ^= fromTo;
+    board.mailbox[from] = piece;
+    board.mailbox[to] = NO_PIECE;
+
+    if (undo.captured != NO_PIECE)
+    {
+        const unsigned square = move.getFlags() == EN_PASSANT ? (color ? to - 8 : to + 8) : to;
+        board.data[undo.captured].value ^= 1ull << square;
+        enemyPieces.value ^= 1ull << square;
+        board.allPieces.value ^= 1ull << square;
+        board.mailbox[square] = static_cast<PieceLoc>(undo.captured);
+    }
+
+    m_board.castlingRights = undo.castlingRights;
+    m_board.enPassantSquare = undo.enPassantSquare;
+    m_halfMoveClock = undo.halfMoveClock;
+    m_board.hashKey = undo.hashKey;
+    m_board.pawnKey = undo.pawnKey;
+    m_board.materialKey = undo.materialKey;
+    m_board.psqtScore = undo.psqtScore;
+    m_board.phase = undo.phase;
+
+    if (!color)
+    {
+        --m_fullMoveClock;
+    }
+
+    m_board.whiteToMove = color;
+    board.moveMade();
+
+    if (m_network != nullptr)
+    {
+        // Moves made before the network was set have no accumulator to go back to
+        if (m_accumulators.size() > 1)
+        {
+            m_accumulators.pop_back();
+        }
+        else
+        {
+            refreshAccumulator();
+        }
+    }
+}
+
+/** Pass the turn to the other side without moving a piece
+ *
+ * Only used by the search for null move pruning, it must be taken back with unmakeNullMove.
+ * Must not be made when in check.
+ */
+void ChessGame::makeNullMove()
+{
+    using namespace board;
+
+    MoveUndo &undo = m_moveHistory.emplace_back();
+    undo.hashKey = m_board.hashKey;
+    undo.pawnKey = m_board.pawnKey;
+    undo.materialKey = m_board.materialKey;
+    undo.psqtScore = m_board.psqtScore;
+    undo.phase = m_board.phase;
+    undo.move = NO_MOVE;
+    undo.captured = NO_PIECE;
+    undo.enPassantSquare = m_board.enPassantSquare;
+    undo.halfMoveClock = m_halfMoveClock;
+    undo.castlingRights = m_board.castlingRights;
+
+    m_board.hashKey ^= ZOBRIST_BLACK_TO_MOVE;
+    if (m_board.enPassantSquare < 64)
+    {
+        m_board.hashKey ^= ZOBRIST_EN_PASSANT[m_board.enPassantSquare % 8];
+    }
+
+    m_board.enPassantSquare = 65;
+    ++m_halfMoveClock;
+    if (!m_board.whiteToMove)
+    {
+        ++m_fullMoveClock;
+    }
+
+    m_board.whiteToMove = !m_board.whiteToMove;
+    m_board.board.moveMade();
+}
+
+/** Take back the last move made with makeNullMove */
+void ChessGame::unmakeNullMove()
+{
+    SL_ASSERT_TRUE(!m_moveHistory.empty() and m_moveHistory.back().move == board::NO_MOVE,
+                   "Error: No null move to take back");
+
+    const MoveUndo undo = m_moveHistory.back();
+    m_moveHistory.pop_back();
+
+    m_board.hashKey = undo.hashKey;
+    m_board.enPassantSquare = undo.enPassantSquare;
+    m_halfMoveClock = undo.halfMoveClock;
+    m_board.whiteToMove = !m_board.whiteToMove;
+    if (!m_board.whiteToMove)
+    {
+        --m_fullMoveClock;
+    }
+
+    m_board.board.moveMade();
+}
+
+/** Make room to make more moves without allocating
+ *
+ * Copying a game only copies the history it has, so whoever is about to make a lot of moves
+ * on a copy, like a search, reserves them first and makeMove never reallocates in the tree.
+ *
+ * @param plies Moves, including null moves, that may be made on top of the current position
+ */
+void ChessGame::reservePlies(int plies)
+{
+    m_moveHistory.reserve(m_moveHistory.size() + plies);
+
+    // Without a network makeMove doesn't add accumulators
+    if (m_network != nullptr)
+    {
+        m_accumulators.reserve(m_accumulators.size() + plies);
+    }
+}
+
+/** Check whether the side to move is in check
+ *
+ * @return True if the king of the side to move is attacked
+ */
+bool ChessGame::isInCheck() const
+{
+    const board::Board &board = m_board.board;
+    const bool color = m_board.whiteToMove;
+    const board::Bitboard &king = board.data[color ? board::WHITE_KING : board::BLACK_KING];
+    if (king.isEmpty())
+    {
+        return false;
+    }
+
+    const uint64_t enemyPieces = (color ? board.blackPieces : board.whitePieces).value;
+    return board::withSliderBackend([&]<board::SliderBackend Backend>() {
+        return board.getAttackersTo<Backend>(king.getLsb(), board.allPieces.value) & enemyPieces;
+    });
+}
+
+/** Check whether the position was already reached since the last capture or pawn move
+ *
+ * Only positions with the same side to move can repeat, so every other position is skipped.
+ * The search stops at a null move.
+ *
+ * @return True if the position occurred before
+ */
+bool ChessGame::isRepetition() const
+{
+    const int size = static_cast<int>(m_moveHistory.size());
+    const int distance = std::min(m_halfMoveClock, size);
+    for (int ply = 1; ply <= distance; ++ply)
+    {
+        const MoveUndo &undo = m_moveHistory[size - ply];
+
+        // Positions before a null move were never really played on the way here
+        if (undo.move == board::NO_MOVE)
+        {
+            return false;
+        }
+
+        if (ply >= 4 and ply % 2 == 0 and undo.hashKey == m_board.hashKey)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Check for a draw by the fifty move rule or by repetition
+ *
+ * A single repetition already counts, playing into it again is never better for the side repeating.
+ *
+ * @return True if the game can be scored as a draw
+ */
+bool ChessGame::isDraw() const { return m_halfMoveClock >= 100 or isRepetition(); }
+
+/** Get the white king
+ *
+ * @return The white king, not valid if there is none
+ */
+board::Piece ChessGame::getWhiteKing() const
+{
+    if (m_board.board.data[board::WHITE_KING].isEmpty())
+    {
+        return {};
+    }
+
+    return getPiece(m_board.board.data[board::WHITE_KING].getLsb());
+}
+
+/** Get the black king
+ *
+ * @return The black king, not valid if there is none
+ */
+board::Piece ChessGame::getBlackKing() const
+{
+    if (m_board.board.data[board::BLACK_KING].isEmpty())
+    {
+        return {};
+    }
+
+    return getPiece(m_board.board.data[board::BLACK_KING].getLsb());
+}
+
+/** Reset the board and piece information */
+void ChessGame::resetGame()
+{
+    m_board.resetBoard();
+    m_board.board.allPieces = 0;
+    m_board.board.whitePieces = 0;
+    m_board.board.blackPieces = 0;
+    m_board.board.genMoveInfo = false;
+
+    m_halfMoveClock = 0;
+    m_fullMoveClock = 0;
+    m_moveHistory.clear();
+    m_accumulators.clear();
+}
+
+/** Create a new game from a FEN string
+ *
+ * @param fen The FEN string
+ */
+void ChessGame::createFromFEN(const std::string &fen) noexcept(false)
+{
+    resetGame();
+
+    m_board.createFromFEN(fen, &m_halfMoveClock, &m_fullMoveClock);
+
+    if (m_board.board.data[board::WHITE_KING].isEmpty() or m_board.board.data[board::BLACK_KING].isEmpty())
+    {
+        throw ChessError("Could not find kings in the FEN string");
+        return;
+    }
+
+    pregenLegalMoves();
+    refreshAccumulator();
 }
 
 /** Get the FEN string for the game
@@ -331,16 +891,48 @@ void ChessGame::createFromFEN(const std::string &fen) noexcept(false)
  */
 std::string ChessGame::getFEN() const { return m_board.getFEN(m_halfMoveClock, m_fullMoveClock); }
 
-ChessGame::~ChessGame()
+/** Evaluate positions with a network from now on
+ *
+ * @param network Loaded network that outlives the game, nullptr to go back to the piece-square tables
+ */
+void ChessGame::setNetwork(const board::Network *network)
+{
+    m_network = network;
+    refreshAccumulator();
+}
+
+/** Start the accumulators over from the current position */
+void ChessGame::refreshAccumulator()
 {
-    if (!m_pieceInformation.empty())
+    m_accumulators.clear();
+    if (m_network == nullptr)
     {
-        for (auto &elem: m_pieceInformation)
-        {
-            delete elem;
-            elem = nullptr;
-        }
+        return;
+    }
 
-        m_pieceInformation.clear();
+    board::Accumulator &accumulator = m_accumulators.emplace_back();
+    m_network->refresh(m_board, board::WHITE, accumulator);
+    m_network->refresh(m_board, board::BLACK, accumulator);
+}
+
+/** Evaluate the current position with the network if one is set, the piece-square tables otherwise
+ *
+ * @param pawnTable Pawn hash table of the calling thread
+ * @param materialTable Material hash table of the calling thread, with the pawn table it adds the pawn structure,
+ *                      the material imbalance and the endgame functions to the piece-square tables
+ * @return Score in centipawns from the side to move's point of view
+ */
+int ChessGame::evaluate(board::PawnTable *pawnTable, board::MaterialTable *materialTable) const
+{
+    if (m_network != nullptr)
+    {
+        return m_network->evaluate(m_accumulators.back(), m_board.whiteToMove);
     }
+
+    if (pawnTable != nullptr and materialTable != nullptr)
+    {
+        return board::evaluate(m_board, *pawnTable, *materialTable);
+    }
+
+    return board::evaluate(m_board);
 }
@@ -0,0 +1,78 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * copy_make.cpp - Copy-make stack of positions
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/copy_make.h"
+
+using namespace chessengine;
+
+/** Start the stack at the current position of a game
+ *
+ * @param game Game to copy the position, clocks and network from
+ */
+CopyMakeStack::CopyMakeStack(const ChessGame &game) : m_frames(board::MAX_PLY + 1), m_network(game.getNetwork())
+{
+    Frame &root = m_frames[0];
+    root.board = *game.getBoard();
+    root.halfMoveClock = game.getHalfMoveClock();
+    root.fullMoveClock = game.getFullMoveClock();
+
+    if (m_network != nullptr)
+    {
+        m_accumulators.resize(board::MAX_PLY + 1);
+        m_accumulators[0] = game.getAccumulator();
+    }
+}
+
+/** Make a move on a copy of the current position
+ *
+ * The clocks follow the same rules as ChessGame::makeMove. The move must be legal for the side to move.
+ *
+ * @param move The move to make
+ */
+void CopyMakeStack::makeMove(board::Move move)
+{
+    using namespace board;
+
+    SL_ASSERT_TRUE(m_ply < MAX_PLY, "Error: Copy-make stack is full");
+
+    const Frame &parent = m_frames[m_ply];
+    Frame &child = m_frames[m_ply + 1];
+    child = parent;
+
+    DirtyPieces dirty;
+    const PieceLoc piece = parent.board.board.getPieceAt(move.getFrom());
+    child.board.makeMove(move, dirty);
+
+    child.halfMoveClock = piece % 6 == WHITE_PAWN or move.isCapture() ? 0 : parent.halfMoveClock + 1;
+    child.fullMoveClock = parent.fullMoveClock + (child.board.whiteToMove ? 1 : 0);
+
+    if (m_network != nullptr)
+    {
+        m_network->update(child.board, dirty, m_accumulators[m_ply], m_accumulators[m_ply + 1]);
+    }
+
+    ++m_ply;
+}
@@ -0,0 +1,229 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * move_picker.cpp - Staged move picker for the search
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/move_picker.h"
+#include "chess_engine/board/see.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+/** Clear every history score */
+void HistoryTable::clear()
+{
+    std::fill_n(&m_table[0][0][0], 2 * 64 * 64, 0);
+}
+
+/** Pull the score of a quiet move towards a bonus
+ *
+ * @param color Side that made the move
+ * @param move The quiet move
+ * @param bonus Positive for a move that caused a cutoff, negative for one that didn't
+ */
+void HistoryTable::update(bool color, Move move, int bonus)
+{
+    bonus = std::clamp(bonus, -MAX_HISTORY, MAX_HISTORY);
+
+    int16_t &entry = m_table[color][move.getFrom()][move.getTo()];
+    entry = static_cast<int16_t>(entry + bonus - entry * std::abs(bonus) / MAX_HISTORY);
+}
+
+/** Create a picker for the main search
+ *
+ * @param game Game to pick the moves for, it must stay in the same position while picking
+ * @param ttMove Best move stored for the position, NO_MOVE if there is none. It does not have to be legal
+ * @param killers The two killer moves of the ply, they do not have to be legal
+ * @param history Scores of the quiet moves
+ */
+MovePicker::MovePicker(ChessGame &game, Move ttMove, const Move *killers, const HistoryTable &history) :
+    m_game(game), m_history(&history), m_ttMove(ttMove), m_killers{killers[0], killers[1]}
+{
+}
+
+/** Create a picker for quiescence, it only gives the captures and promotions that don't lose material
+ *
+ * @param game Game to pick the moves for, it must stay in the same position while picking
+ */
+MovePicker::MovePicker(ChessGame &game) : m_game(game), m_stage(GENERATE_CAPTURES), m_capturesOnly(true) {}
+
+/** Get the next move to search
+ *
+ * @return The next legal move, NO_MOVE once every move was returned
+ */
+Move MovePicker::nextMove()
+{
+    switch (m_stage)
+    {
+        case TT_MOVE:
+            m_stage = GENERATE_CAPTURES;
+            if (m_game.isLegal(m_ttMove))
+            {
+                return m_ttMove;
+            }
+            [[fallthrough]];
+
+        case GENERATE_CAPTURES:
+            m_game.generateCaptures(m_captures);
+            scoreCaptures();
+            m_current = 0;
+            m_stage = GOOD_CAPTURES;
+            [[fallthrough]];
+
+        case GOOD_CAPTURES:
+            while (m_current < m_captures.getSize())
+            {
+                const Move move = pickBest(m_captures);
+                if (move == m_ttMove)
+                {
+                    continue;
+                }
+
+                if (!see(*m_game.getBoard(), move, 0))
+                {
+                    m_captures[m_badCaptures++] = move;
+                    continue;
+                }
+
+                return move;
+            }
+
+            if (m_capturesOnly)
+            {
+                m_stage = DONE;
+                return NO_MOVE;
+            }
+
+            m_stage = KILLERS;
+            [[fallthrough]];
+
+        case KILLERS:
+            while (m_killerIndex < 2)
+            {
+                const Move killer = m_killers[m_killerIndex++];
+                if (killer != m_ttMove and !killer.isCapture() and !killer.isPromotion() and m_game.isLegal(killer))
+                {
+                    return killer;
+                }
+            }
+
+            m_stage = GENERATE_QUIETS;
+            [[fallthrough]];
+
+        case GENERATE_QUIETS:
+            m_game.generateQuiets(m_quiets);
+            scoreQuiets();
+            m_current = 0;
+            m_stage = QUIETS;
+            [[fallthrough]];
+
+        case QUIETS:
+            while (m_current < m_quiets.getSize())
+            {
+                const Move move = pickBest(m_quiets);
+                if (move != m_ttMove and move != m_killers[0] and move != m_killers[1])
+                {
+                    return move;
+                }
+            }
+
+            m_current = 0;
+            m_stage = BAD_CAPTURES;
+            [[fallthrough]];
+
+        case BAD_CAPTURES:
+            if (m_current < m_badCaptures)
+            {
+                return m_captures[m_current++];
+            }
+
+            m_stage = DONE;
+            [[fallthrough]];
+
+        case DONE: break;
+    }
+
+    return NO_MOVE;
+}
+
+/** Score the captures by the most valuable victim and the least valuable attacker, promotions by the new piece */
+void MovePicker::scoreCaptures()
+{
+    const Board &board = m_game.getBoard()->board;
+    for (unsigned i = 0; i < m_captures.getSize(); ++i)
+    {
+        const Move move = m_captures[i];
+        int score = 0;
+        if (move.isCapture())
+        {
+            const PieceLoc victim = move.getFlags() == EN_PASSANT ? WHITE_PAWN : board.getPieceAt(move.getTo());
+            score = SEE_VALUES[victim % 6] * 8 - board.getPieceAt(move.getFrom()) % 6;
+        }
+
+        if (move.isPromotion())
+        {
+            score += SEE_VALUES[WHITE_KNIGHT + move.getPromotionOffset()];
+        }
+
+        m_scores[i] = score;
+    }
+}
+
+/** Score the quiet moves by their history */
+void MovePicker::scoreQuiets()
+{
+    const bool color = m_game.getBoard()->whiteToMove;
+    for (unsigned i = 0; i < m_quiets.getSize(); ++i)
+    {
+        m_scores[i] = m_history->get(color, m_quiets[i]);
+    }
+}
+
+/** Take the best scored move left in a list
+ *
+ * A selection step instead of sorting the whole list, after an early cutoff
+ * the rest of the list is never looked at.
+ *
+ * @param moves List the scores belong to
+ * @return The best move from the current index on, the current index moves past it
+ */
+Move MovePicker::pickBest(MoveList &moves)
+{
+    unsigned best = m_current;
+    for (unsigned i = m_current + 1; i < moves.getSize(); ++i)
+    {
+        if (m_scores[i] > m_scores[best])
+        {
+            best = i;
+        }
+    }
+
+    std::swap(moves[best], moves[m_current]);
+    std::swap(m_scores[best], m_scores[m_current]);
+    return moves[m_current++];
+}
@@ -0,0 +1,321 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * perft.cpp - Move generation node counting
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/perft.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+using namespace chessengine;
+
+/** Count the leaf nodes of the move tree
+ *
+ * The last ply isn't played out, the size of the legal move list already is the number of leaves.
+ *
+ * @param game Game to count from, it is left in the same position
+ * @param depth Number of plies to count to
+ * @return Number of leaf nodes
+ */
+uint64_t chessengine::perft(ChessGame &game, int depth)
+{
+    if (depth <= 0)
+    {
+        return 1;
+    }
+
+    board::MoveList moves;
+    game.generateLegalMoves(moves);
+    if (depth == 1)
+    {
+        return moves.getSize();
+    }
+
+    uint64_t nodes = 0;
+    for (const board::Move move: moves)
+    {
+        game.makeMove(move);
+        nodes += perft(game, depth - 1);
+        game.unmakeMove();
+    }
+
+    return nodes;
+}
+
+/** Create a table
+ *
+ * @param megabytes Size of the table in megabytes, rounded down to a power of two entries
+ */
+PerftHashTable::PerftHashTable(size_t megabytes) :
+    m_entries(std::bit_floor(std::max<size_t>(megabytes, 1) * 1024 * 1024 / sizeof(Entry)), Entry{0, 0})
+{
+}
+
+/** Look up the node count of a subtree
+ *
+ * @param key Zobrist key of the position
+ * @param depth Depth the nodes were counted to
+ * @param nodes Set to the node count when it is found
+ * @return True if the subtree was found
+ */
+bool PerftHashTable::probe(uint64_t key, int depth, uint64_t &nodes) const
+{
+    const Entry &entry = m_entries[key & (m_entries.size() - 1)];
+    const uint64_t data = std::atomic_ref<const uint64_t>(entry.data).load(std::memory_order_relaxed);
+    const uint64_t check = std::atomic_ref<const uint64_t>(entry.key).load(std::memory_order_relaxed);
+
+    if ((check ^ data) != key or static_cast<int>(data >> 56) != depth)
+    {
+        return false;
+    }
+
+    nodes = data & 0xffffffffffffffull;
+    return true;
+}
+
+/** Store the node count of a subtree, always replacing what was there
+ *
+ * @param key Zobrist key of the position
+ * @param depth Depth the nodes were counted to
+ * @param nodes Number of nodes
+ */
+void PerftHashTable::store(uint64_t key, int depth, uint64_t nodes)
+{
+    Entry &entry = m_entries[key & (m_entries.size() - 1)];
+    const uint64_t data = static_cast<uint64_t>(depth) << 56 | nodes;
+
+    std::atomic_ref<uint64_t>(entry.key).store(key ^ data, std::memory_order_relaxed);
+    std::atomic_ref<uint64_t>(entry.data).store(data, std::memory_order_relaxed);
+}
+
+/** Count the leaf nodes of the move tree, reusing the counts of transposed subtrees
+ *
+ * @param game Game to count from, it is left in the same position
+ * @param depth Number of plies to count to
+ * @param hashTable Table of subtree counts, may be shared between threads
+ * @return Number of leaf nodes
+ */
+uint64_t chessengine::perft(ChessGame &game, int depth, PerftHashTable &hashTable)
+{
+    // Leaves are cheaper to count than to look up
+    if (depth <= 2)
+    {
+        return perft(game, depth);
+    }
+
+    uint64_t nodes = 0;
+    if (hashTable.probe(game.getHashKey(), depth, nodes))
+    {
+        return nodes;
+    }
+
+    board::MoveList moves;
+    game.generateLegalMoves(moves);
+    for (const board::Move move: moves)
+    {
+        game.makeMove(move);
+        nodes += perft(game, depth - 1, hashTable);
+        game.unmakeMove();
+    }
+
+    hashTable.store(game.getHashKey(), depth, nodes);
+    return nodes;
+}
+
+/** Count the leaf nodes of the move tree and time it
+ *
+ * @param game Game to count from, it is left in the same position
+ * @param depth Number of plies to count to
+ * @param divide Also record the node count below every root move
+ * @return Node count and timing
+ */
+PerftResult chessengine::runPerft(ChessGame &game, int depth, bool divide)
+{
+    PerftResult result;
+    const auto start = std::chrono::steady_clock::now();
+
+    if (divide and depth > 0)
+    {
+        board::MoveList moves;
+        game.generateLegalMoves(moves);
+        for (const board::Move move: moves)
+        {
+            game.makeMove(move);
+            const uint64_t nodes = perft(game, depth - 1);
+            game.unmakeMove();
+
+            result.divide.emplace_back(move, nodes);
+            result.nodes += nodes;
+        }
+    }
+    else
+    {
+        result.nodes = perft(game, depth);
+    }
+
+    result.time = std::chrono::steady_clock::now() - start;
+    return result;
+}
+
+/** Count the leaf nodes of the move tree on several threads
+ *
+ * The tree is split two plies down and the threads take the subtrees from a shared counter,
+ * every thread plays its subtrees out on its own copy of the game.
+ *
+ * @param game Game to count from
+ * @param depth Number of plies to count to
+ * @param threads Number of threads to count with
+ * @param hashMegabytes Size of the shared table of subtree counts, 0 to count every subtree
+ * @return Node count, timing and the count below every root move
+ */
+PerftResult chessengine::runParallelPerft(const ChessGame &game, int depth, unsigned threads, size_t hashMegabytes)
+{
+    PerftResult result;
+    const auto start = std::chrono::steady_clock::now();
+
+    ChessGame root = game;
+    board::MoveList rootMoves;
+    root.generateLegalMoves(rootMoves);
+
+    struct Task
+    {
+        unsigned rootIndex;
+        board::Move reply;
+    };
+
+    // Subtrees two plies down, or just the root moves when that is all there is
+    std::vector<Task> tasks;
+    for (unsigned j = 0; j < rootMoves.getSize() and depth > 0; ++j)
+    {
+        if (depth < 3)
+        {
+            tasks.push_back({j, board::NO_MOVE});
+            continue;
+        }
+
+        root.makeMove(rootMoves[j]);
+        board::MoveList replies;
+        root.generateLegalMoves(replies);
+        for (const board::Move reply: replies)
+        {
+            tasks.push_back({j, reply});
+        }
+        root.unmakeMove();
+    }
+
+    std::unique_ptr<PerftHashTable> hashTable;
+    if (hashMegabytes > 0)
+    {
+        hashTable = std::make_unique<PerftHashTable>(hashMegabytes);
+    }
+
+    std::vector<std::atomic<uint64_t>> rootNodes(rootMoves.getSize());
+    std::atomic<size_t> nextTask = 0;
+
+    auto worker = [&]() {
+        ChessGame local = root;
+        local.reservePlies(depth);
+        for (size_t j = nextTask++; j < tasks.size(); j = nextTask++)
+        {
+            const Task &task = tasks[j];
+            local.makeMove(rootMoves[task.rootIndex]);
+
+            uint64_t nodes;
+            if (task.reply == board::NO_MOVE)
+            {
+                nodes = perft(local, depth - 1);
+            }
+            else
+            {
+                local.makeMove(task.reply);
+                nodes = hashTable ? perft(local, depth - 2, *hashTable) : perft(local, depth - 2);
+                local.unmakeMove();
+            }
+
+            local.unmakeMove();
+            rootNodes[task.rootIndex].fetch_add(nodes, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::jthread> pool;
+    for (unsigned j = 1; j < std::max(threads, 1u); ++j)
+    {
+        pool.emplace_back(worker);
+    }
+
+    worker();
+    pool.clear(); // Joins the threads
+
+    if (depth <= 0)
+    {
+        result.nodes = 1;
+    }
+
+    for (unsigned j = 0; j < rootMoves.getSize() and depth > 0; ++j)
+    {
+        result.divide.emplace_back(rootMoves[j], rootNodes[j].load());
+        result.nodes += rootNodes[j].load();
+    }
+
+    result.time = std::chrono::steady_clock::now() - start;
+    return result;
+}
+
+/** Get the speed of the run
+ *
+ * @return Nodes counted per second
+ */
+uint64_t PerftResult::getNodesPerSecond() const
+{
+    const auto nanoseconds = std::max<int64_t>(time.count(), 1);
+    return static_cast<uint64_t>(static_cast<double>(nodes) * 1e9 / static_cast<double>(nanoseconds));
+}
+
+/** Get the result in the usual divide format
+ *
+ * @return One line per root move followed by the totals
+ */
+std::string PerftResult::toString() const
+{
+    std::stringstream output;
+    for (const auto &[move, nodes]: divide)
+    {
+        output << move.toString() << ": " << nodes << '\n';
+    }
+
+    if (!divide.empty())
+    {
+        output << '\n';
+    }
+
+    output << "Nodes searched: " << nodes << '\n';
+    output << "Time: " << std::chrono::duration_cast<std::chrono::milliseconds>(time).count() << "ms\n";
+    output << "Nodes per second: " << getNodesPerSecond() << '\n';
+    return output.str();
+}
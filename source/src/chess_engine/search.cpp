@@ -0,0 +1,703 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * search.cpp - Alpha-beta search with iterative deepening
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/search.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <sstream>
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+namespace
+{
+
+/* Piece values in centipawns for delta pruning, indexed by PieceLoc % 6 */
+constexpr int PIECE_VALUES[6] = {100, 320, 330, 500, 900, 0};
+
+/* A capture has to be able to raise the score to within this margin of alpha to be searched in quiescence */
+constexpr int DELTA_MARGIN = 200;
+
+/* Selective search, the margins are in centipawns per ply of remaining depth */
+constexpr int RFP_MAX_DEPTH = 6;
+constexpr int RFP_MARGIN = 80;
+constexpr int NMP_MIN_DEPTH = 3;
+constexpr int NMP_REDUCTION = 3;
+constexpr int FUTILITY_MAX_DEPTH = 3;
+constexpr int FUTILITY_MARGIN = 120;
+constexpr int LMR_MIN_DEPTH = 3;
+
+/* Late move reductions by remaining depth and move number, grows with the log of both */
+const auto LMR_TABLE = []
+{
+    std::array<std::array<int, 64>, 64> table{};
+    for (int depth = 1; depth < 64; ++depth)
+    {
+        for (int moveCount = 1; moveCount < 64; ++moveCount)
+        {
+            table[depth][moveCount] = static_cast<int>(0.75 + std::log(depth) * std::log(moveCount) / 2.25);
+        }
+    }
+
+    return table;
+}();
+
+/* Quiet moves remembered per node to lower their history after a cutoff by another quiet move */
+constexpr int MAX_QUIETS_SEARCHED = 64;
+
+/* How many nodes are searched between looking at the clock */
+constexpr uint64_t NODES_BETWEEN_CHECKS = 2048;
+
+/* Depths the helper threads skip, a helper skips a depth when ((depth + phase) / size) is odd */
+constexpr int SKIP_SIZE[20] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+constexpr int SKIP_PHASE[20] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+/** Make a mate score relative to the position it is stored for instead of the root */
+int scoreToTT(int score, int ply)
+{
+    if (score >= MATE_IN_MAX_PLY)
+    {
+        return score + ply;
+    }
+
+    if (score <= -MATE_IN_MAX_PLY)
+    {
+        return score - ply;
+    }
+
+    return score;
+}
+
+/** Make a mate score from the table relative to the root again */
+int scoreFromTT(int score, int ply)
+{
+    if (score >= MATE_IN_MAX_PLY)
+    {
+        return score - ply;
+    }
+
+    if (score <= -MATE_IN_MAX_PLY)
+    {
+        return score + ply;
+    }
+
+    return score;
+}
+
+/** Check whether the side to move has a piece other than pawns and the king */
+bool hasNonPawnMaterial(const ChessBoard &board)
+{
+    const int own = board.whiteToMove ? 0 : 6; // Black pieces are stored after the white pieces
+    for (int j = WHITE_KNIGHT; j <= WHITE_QUEEN; ++j)
+    {
+        if (!board.board.data[j + own].isEmpty())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
+
+/** Get the nodes searched per second
+ *
+ * @return Nodes per second, zero if no time was measured
+ */
+uint64_t SearchInfo::getNodesPerSecond() const
+{
+    if (time.count() <= 0)
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(static_cast<double>(nodes) * 1e9 / static_cast<double>(time.count()));
+}
+
+/** Format the iteration like a UCI info line
+ *
+ * @return depth, score, nodes, nps, time in milliseconds and the principal variation
+ */
+std::string SearchInfo::toString() const
+{
+    std::ostringstream stream;
+    stream << "depth " << depth << " seldepth " << selDepth << " score ";
+    if (std::abs(score) >= MATE_IN_MAX_PLY)
+    {
+        // Moves, not plies, until mate
+        const int plies = MATE_SCORE - std::abs(score);
+        stream << "mate " << (score > 0 ? (plies + 1) / 2 : -plies / 2);
+    }
+    else
+    {
+        stream << "cp " << score;
+    }
+
+    stream << " nodes " << nodes << " nps " << getNodesPerSecond() << " hashfull " << hashfull << " time "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(time).count() << " pv";
+    for (const Move move: pv)
+    {
+        stream << " " << move.toString();
+    }
+
+    return stream.str();
+}
+
+/** Create a search
+ *
+ * @param game Game to search, it is copied so the caller's game is never touched
+ * @param transpositionTable Table shared with every other search
+ * @param stop Set to stop the search, the main thread also sets it when it runs into its limits
+ * @param threadId Index of the thread running the search, 0 for the main thread
+ * @param options Selective search techniques to use
+ */
+Search::Search(const ChessGame &game, TranspositionTable &transpositionTable, std::atomic<bool> &stop,
+               unsigned threadId, const SearchOptions &options) :
+    m_game(game), m_transpositionTable(transpositionTable), m_stop(stop), m_threadId(threadId), m_options(options)
+{
+    // No line goes deeper than MAX_PLY, so making moves in the tree never allocates
+    m_game.reservePlies(MAX_PLY);
+}
+
+/** Search the position with iterative deepening
+ *
+ * Every iteration searches one ply deeper than the last. An iteration interrupted by the
+ * limits or by the stop flag is thrown away, except when not even the first one finished.
+ *
+ * @param limits When to stop searching
+ * @param onIteration Called with the result of every finished iteration
+ * @return Best move and information of the last finished iteration
+ */
+SearchResult Search::run(const SearchLimits &limits, const SearchCallback &onIteration)
+{
+    m_limits = limits;
+    m_startTime = std::chrono::steady_clock::now();
+    m_clockStart = m_startTime;
+    m_nodes.store(0, std::memory_order_relaxed);
+    std::fill_n(&m_killers[0][0], MAX_PLY * 2, NO_MOVE);
+    m_history.clear();
+
+    SearchResult result;
+
+    MoveList rootMoves;
+    m_game.generateLegalMoves(rootMoves);
+    if (rootMoves.isEmpty())
+    {
+        result.info.score = m_game.isInCheck() ? -MATE_SCORE : DRAW_SCORE;
+        return result;
+    }
+
+    result.bestMove = rootMoves[0];
+    for (const Move move: limits.searchMoves)
+    {
+        if (rootMoves.contains(move))
+        {
+            result.bestMove = move;
+            break;
+        }
+    }
+
+    const int maxDepth = std::clamp(limits.depth, 1, MAX_PLY - 1);
+    for (int depth = 1; depth <= maxDepth; ++depth)
+    {
+        if (isDepthSkipped(depth))
+        {
+            continue;
+        }
+
+        m_selDepth = 0;
+        const int score = negamax(-INFINITE_SCORE, INFINITE_SCORE, depth, 0);
+        if (m_stop.load(std::memory_order_relaxed) and (depth > 1 or m_pvLength[0] == 0))
+        {
+            break;
+        }
+
+        result.bestMove = m_pvTable[0][0];
+        result.info.depth = depth;
+        result.info.selDepth = m_selDepth;
+        result.info.score = score;
+        result.info.pv.assign(m_pvTable[0], m_pvTable[0] + m_pvLength[0]);
+        result.info.nodes = getNodes();
+        result.info.time = std::chrono::steady_clock::now() - m_startTime;
+
+        if (onIteration)
+        {
+            result.info.hashfull = m_transpositionTable.getHashfull();
+            onIteration(result.info);
+        }
+
+        if (m_stop.load(std::memory_order_relaxed))
+        {
+            break;
+        }
+
+        // The mate asked for is found
+        if (limits.mate > 0 and score >= MATE_SCORE - 2 * limits.mate + 1)
+        {
+            break;
+        }
+
+        // Another iteration would most likely not finish in time
+        if (isMainThread() and limits.softTime.count() > 0 and getClockTime() >= limits.softTime)
+        {
+            break;
+        }
+    }
+
+    // The helpers keep searching until the main thread is done
+    if (isMainThread())
+    {
+        m_stop.store(true, std::memory_order_relaxed);
+    }
+
+    result.info.nodes = getNodes();
+    result.info.time = std::chrono::steady_clock::now() - m_startTime;
+    return result;
+}
+
+/** Search a position with alpha-beta, scores outside the window are only bounds
+ *
+ * @param alpha Score the side to move is already guaranteed
+ * @param beta Score the opponent is already guaranteed
+ * @param depth Remaining depth in plies
+ * @param ply Distance from the root
+ * @return Score of the position from the side to move's point of view
+ */
+int Search::negamax(int alpha, int beta, int depth, int ply)
+{
+    if (depth <= 0)
+    {
+        return quiescence(alpha, beta, ply);
+    }
+
+    m_pvLength[ply] = ply;
+    m_selDepth = std::max(m_selDepth, ply + 1);
+    countNode();
+
+    if (m_stop.load(std::memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    if (ply > 0 and m_game.isDraw())
+    {
+        return DRAW_SCORE;
+    }
+
+    if (ply >= MAX_PLY - 1)
+    {
+        return evaluate();
+    }
+
+    const bool pvNode = beta - alpha > 1;
+    const uint64_t key = m_game.getHashKey();
+
+    TTData ttData{};
+    const bool ttHit = m_transpositionTable.probe(key, ttData);
+    if (ttHit and !pvNode and ttData.depth >= depth)
+    {
+        const int ttScore = scoreFromTT(ttData.score, ply);
+        if (ttData.bound == BOUND_EXACT or (ttData.bound == BOUND_LOWER and ttScore >= beta) or
+            (ttData.bound == BOUND_UPPER and ttScore <= alpha))
+        {
+            return ttScore;
+        }
+    }
+
+    const bool inCheck = m_game.isInCheck();
+    const int staticEval = inCheck ? -INFINITE_SCORE : ttHit ? ttData.eval : evaluate();
+
+    if (!pvNode and !inCheck and ply > 0)
+    {
+        // Reverse futility pruning, the position is so far above beta that a few quiet moves won't bring it back
+        if (m_options.reverseFutilityPruning and depth <= RFP_MAX_DEPTH and std::abs(beta) < MATE_IN_MAX_PLY and
+            staticEval - RFP_MARGIN * depth >= beta)
+        {
+            return staticEval;
+        }
+
+        // Null move pruning, if passing still fails high a real move will too. Without pieces other than
+        // pawns passing could be the only thing that doesn't lose (zugzwang), so the position isn't trusted
+        if (m_options.nullMovePruning and depth >= NMP_MIN_DEPTH and staticEval >= beta and
+            hasNonPawnMaterial(*m_game.getBoard()))
+        {
+            const int reduction = NMP_REDUCTION + depth / 6;
+            m_game.makeNullMove();
+            const int score = -negamax(-beta, -beta + 1, depth - 1 - reduction, ply + 1);
+            m_game.unmakeNullMove();
+
+            if (m_stop.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            if (score >= beta)
+            {
+                // A mate found after passing isn't proven
+                return score >= MATE_IN_MAX_PLY ? beta : score;
+            }
+        }
+    }
+
+    const bool canFutilityPrune = m_options.futilityPruning and !pvNode and !inCheck and
+                                  depth <= FUTILITY_MAX_DEPTH and staticEval + FUTILITY_MARGIN * depth <= alpha;
+
+    MovePicker picker(m_game, ttHit ? ttData.move : NO_MOVE, m_killers[ply], m_history);
+
+    const int originalAlpha = alpha;
+    int bestScore = -INFINITE_SCORE;
+    Move bestMove = NO_MOVE;
+    int moveCount = 0;
+    Move quiets[MAX_QUIETS_SEARCHED];
+    int quietCount = 0;
+    for (Move move = picker.nextMove(); move != NO_MOVE; move = picker.nextMove())
+    {
+        if (ply == 0 and !m_limits.searchMoves.empty() and
+            std::find(m_limits.searchMoves.begin(), m_limits.searchMoves.end(), move) == m_limits.searchMoves.end())
+        {
+            continue;
+        }
+
+        ++moveCount;
+        const bool quiet = !move.isCapture() and !move.isPromotion();
+
+        m_game.makeMove(move);
+        m_transpositionTable.prefetch(m_game.getHashKey());
+        const bool givesCheck = m_game.isInCheck();
+
+        // Futility pruning, near the leaves a quiet move can't raise a score that far below alpha
+        if (canFutilityPrune and quiet and !givesCheck and moveCount > 1)
+        {
+            m_game.unmakeMove();
+            continue;
+        }
+
+        const int newDepth = depth - 1 + (m_options.checkExtensions and givesCheck ? 1 : 0);
+
+        // The first move is expected to be the best, the others only have to be shown worse
+        int score;
+        if (moveCount == 1)
+        {
+            score = -negamax(-beta, -alpha, newDepth, ply + 1);
+        }
+        else
+        {
+            // Late move reductions, quiet moves ordered last are searched shallower first
+            int reduction = 0;
+            if (m_options.lateMoveReductions and depth >= LMR_MIN_DEPTH and moveCount > 1 + pvNode and quiet and
+                !inCheck and !givesCheck)
+            {
+                reduction = LMR_TABLE[std::min(depth, 63)][std::min(moveCount, 63)] - pvNode;
+                reduction = std::clamp(reduction, 0, newDepth - 1);
+            }
+
+            score = -negamax(-alpha - 1, -alpha, newDepth - reduction, ply + 1);
+            if (reduction > 0 and score > alpha)
+            {
+                score = -negamax(-alpha - 1, -alpha, newDepth, ply + 1);
+            }
+
+            if (score > alpha and score < beta)
+            {
+                score = -negamax(-beta, -alpha, newDepth, ply + 1);
+            }
+        }
+
+        m_game.unmakeMove();
+
+        if (m_stop.load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestMove = move;
+
+            if (score > alpha)
+            {
+                alpha = score;
+                updatePv(ply, move);
+
+                if (alpha >= beta)
+                {
+                    if (quiet)
+                    {
+                        updateQuietMoves(ply, depth, move, quiets, quietCount);
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (quiet and quietCount < MAX_QUIETS_SEARCHED)
+        {
+            quiets[quietCount++] = move;
+        }
+    }
+
+    if (moveCount == 0)
+    {
+        return inCheck ? -MATE_SCORE + ply : DRAW_SCORE;
+    }
+
+    const Bound bound = bestScore >= beta ? BOUND_LOWER : bestScore > originalAlpha ? BOUND_EXACT : BOUND_UPPER;
+    m_transpositionTable.store(key, bestMove, scoreToTT(bestScore, ply), inCheck ? DRAW_SCORE : staticEval, depth,
+                               bound);
+
+    return bestScore;
+}
+
+/** Search only the captures and promotions until the position is quiet
+ *
+ * The side to move may stand pat on the static evaluation instead of capturing, except when in
+ * check where every evasion is searched. Captures that can't bring the score close to alpha even
+ * when winning the captured piece for free are skipped (delta pruning), as are underpromotions.
+ *
+ * @param alpha Score the side to move is already guaranteed
+ * @param beta Score the opponent is already guaranteed
+ * @param ply Distance from the root
+ * @return Score of the position from the side to move's point of view
+ */
+int Search::quiescence(int alpha, int beta, int ply)
+{
+    m_pvLength[ply] = ply;
+    m_selDepth = std::max(m_selDepth, ply + 1);
+    countNode();
+
+    if (m_stop.load(std::memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    if (m_game.isDraw())
+    {
+        return DRAW_SCORE;
+    }
+
+    const ChessBoard &board = *m_game.getBoard();
+    if (ply >= MAX_PLY - 1)
+    {
+        return evaluate();
+    }
+
+    const bool inCheck = m_game.isInCheck();
+    int standPat = -INFINITE_SCORE;
+    if (!inCheck)
+    {
+        standPat = evaluate();
+        if (standPat >= beta)
+        {
+            return standPat;
+        }
+
+        alpha = std::max(alpha, standPat);
+    }
+
+    // In check every evasion is searched, otherwise only the captures that don't lose material
+    MovePicker picker = inCheck ? MovePicker(m_game, NO_MOVE, m_killers[ply], m_history) : MovePicker(m_game);
+
+    int bestScore = standPat;
+    int moveCount = 0;
+    for (Move move = picker.nextMove(); move != NO_MOVE; move = picker.nextMove())
+    {
+        ++moveCount;
+        if (!inCheck)
+        {
+            if (move.isPromotion() and WHITE_KNIGHT + move.getPromotionOffset() != WHITE_QUEEN)
+            {
+                continue;
+            }
+
+            int gain = 0;
+            if (move.getFlags() == EN_PASSANT)
+            {
+                gain = PIECE_VALUES[0];
+            }
+            else if (move.isCapture())
+            {
+                gain = PIECE_VALUES[board.board.getPieceAt(move.getTo()) % 6];
+            }
+
+            if (move.isPromotion())
+            {
+                gain += PIECE_VALUES[4] - PIECE_VALUES[0];
+            }
+
+            if (standPat + gain + DELTA_MARGIN <= alpha)
+            {
+                continue;
+            }
+        }
+
+        m_game.makeMove(move);
+        const int score = -quiescence(-beta, -alpha, ply + 1);
+        m_game.unmakeMove();
+
+        if (m_stop.load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            if (score > alpha)
+            {
+                alpha = score;
+                updatePv(ply, move);
+
+                if (alpha >= beta)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (inCheck and moveCount == 0)
+    {
+        return -MATE_SCORE + ply;
+    }
+
+    return bestScore;
+}
+
+/** Evaluate the current position with the tables of this thread */
+int Search::evaluate() { return m_game.evaluate(&m_pawnTable, &m_materialTable); }
+
+/** Count a searched node and look at the limits every so often */
+void Search::countNode()
+{
+    const uint64_t nodes = m_nodes.load(std::memory_order_relaxed) + 1;
+    m_nodes.store(nodes, std::memory_order_relaxed);
+
+    if (nodes % NODES_BETWEEN_CHECKS == 0 and shouldStop())
+    {
+        m_stop.store(true, std::memory_order_relaxed);
+    }
+}
+
+/** Remember a quiet move that caused a beta cutoff
+ *
+ * It becomes the first killer move of the ply and its history is raised, while the
+ * quiet moves searched before it without a cutoff have their history lowered.
+ *
+ * @param ply Ply of the cutoff
+ * @param depth Remaining depth of the node, deeper cutoffs count for more
+ * @param bestMove The quiet move that caused the cutoff
+ * @param quiets Quiet moves searched before it
+ * @param quietCount Number of quiet moves searched before it
+ */
+void Search::updateQuietMoves(int ply, int depth, Move bestMove, const Move *quiets, int quietCount)
+{
+    if (m_killers[ply][0] != bestMove)
+    {
+        m_killers[ply][1] = m_killers[ply][0];
+        m_killers[ply][0] = bestMove;
+    }
+
+    const bool color = m_game.getBoard()->whiteToMove;
+    const int bonus = std::min(depth * depth, 400) * 16;
+    m_history.update(color, bestMove, bonus);
+    for (int j = 0; j < quietCount; ++j)
+    {
+        m_history.update(color, quiets[j], -bonus);
+    }
+}
+
+/** Store a new best move at a ply, followed by the best line found after it
+ *
+ * @param ply Ply the move was made at
+ * @param move The new best move
+ */
+void Search::updatePv(int ply, Move move)
+{
+    m_pvTable[ply][ply] = move;
+    for (int j = ply + 1; j < m_pvLength[ply + 1]; ++j)
+    {
+        m_pvTable[ply][j] = m_pvTable[ply + 1][j];
+    }
+
+    m_pvLength[ply] = std::max(m_pvLength[ply + 1], ply + 1);
+}
+
+/** Check whether the search ran into its time or node limit
+ *
+ * @return True if the search should stop
+ */
+bool Search::shouldStop()
+{
+    if (!isMainThread())
+    {
+        return false;
+    }
+
+    if (m_limits.nodes > 0 and getNodes() >= m_limits.nodes)
+    {
+        return true;
+    }
+
+    return m_limits.moveTime.count() > 0 and getClockTime() >= m_limits.moveTime;
+}
+
+/** Get the time spent on the search's own clock
+ *
+ * While pondering the clock stands still at zero, so after ponderhit the time limits count from
+ * about the node check where pondering was seen to end.
+ *
+ * @return Time since the search started, or since ponderhit
+ */
+std::chrono::nanoseconds Search::getClockTime()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (m_limits.isPondering())
+    {
+        m_clockStart = now;
+    }
+
+    return now - m_clockStart;
+}
+
+/** Check whether this thread leaves a depth to the other threads
+ *
+ * @param depth Depth of the iteration
+ * @return True for a helper thread skipping the depth, never for the main thread
+ */
+bool Search::isDepthSkipped(int depth) const
+{
+    if (isMainThread() or depth == 1)
+    {
+        return false;
+    }
+
+    const unsigned index = (m_threadId - 1) % 20;
+    return (depth + SKIP_PHASE[index]) / SKIP_SIZE[index] % 2 != 0;
+}
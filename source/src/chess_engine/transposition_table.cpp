@@ -0,0 +1,264 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * transposition_table.cpp - Shared lockless transposition table
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/transposition_table.h"
+#include "chess_engine/chess_error.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#elif defined(_WIN32)
+#include <malloc.h>
+#endif
+
+using namespace chessengine;
+
+namespace
+{
+
+/* Packed layout of the data word */
+constexpr int MOVE_SHIFT = 0;
+constexpr int SCORE_SHIFT = 16;
+constexpr int EVAL_SHIFT = 32;
+constexpr int DEPTH_SHIFT = 48;
+constexpr int BOUND_SHIFT = 56;
+constexpr int GENERATION_SHIFT = 58;
+
+/* Generations wrap around in the top six bits */
+constexpr int GENERATION_MASK = 0x3f;
+
+/* Huge pages are 2MB on x86-64 Linux */
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+uint64_t load(const uint64_t &word)
+{
+    return std::atomic_ref<const uint64_t>(word).load(std::memory_order_relaxed);
+}
+
+void save(uint64_t &word, uint64_t value)
+{
+    std::atomic_ref<uint64_t>(word).store(value, std::memory_order_relaxed);
+}
+
+uint64_t pack(board::Move move, int score, int eval, int depth, Bound bound, uint8_t generation)
+{
+    return static_cast<uint64_t>(move.getValue()) << MOVE_SHIFT |
+           static_cast<uint64_t>(static_cast<uint16_t>(score)) << SCORE_SHIFT |
+           static_cast<uint64_t>(static_cast<uint16_t>(eval)) << EVAL_SHIFT |
+           static_cast<uint64_t>(std::clamp(depth, 0, 255)) << DEPTH_SHIFT |
+           static_cast<uint64_t>(bound) << BOUND_SHIFT | static_cast<uint64_t>(generation) << GENERATION_SHIFT;
+}
+
+board::Move getMove(uint64_t data) { return board::Move::fromValue(static_cast<uint16_t>(data >> MOVE_SHIFT)); }
+
+int getDepth(uint64_t data) { return static_cast<int>(data >> DEPTH_SHIFT & 0xff); }
+
+Bound getBound(uint64_t data) { return static_cast<Bound>(data >> BOUND_SHIFT & 3); }
+
+int getGeneration(uint64_t data) { return static_cast<int>(data >> GENERATION_SHIFT & GENERATION_MASK); }
+
+} // namespace
+
+/** Create a table
+ *
+ * @param megabytes Size of the table in megabytes
+ */
+TranspositionTable::TranspositionTable(size_t megabytes) { resize(megabytes); }
+
+TranspositionTable::~TranspositionTable() { release(); }
+
+/** Free the table's memory */
+void TranspositionTable::release()
+{
+#if defined(_WIN32)
+    _aligned_free(m_clusters);
+#else
+    std::free(m_clusters);
+#endif
+
+    m_clusters = nullptr;
+    m_clusterCount = 0;
+    m_bytes = 0;
+}
+
+/** Reallocate the table, clearing every entry
+ *
+ * The cluster count is rounded down to a power of two so a key is mapped to a cluster with a mask.
+ * Must not be called while a search is using the table.
+ *
+ * @param megabytes Size of the table in megabytes, at least 1
+ * @param hugePages Ask the kernel to back the table with huge pages, only used on Linux
+ */
+void TranspositionTable::resize(size_t megabytes, bool hugePages) noexcept(false)
+{
+    const size_t clusters = std::bit_floor(std::max<size_t>(megabytes, 1) * 1024 * 1024 / sizeof(Cluster));
+    const size_t bytes = clusters * sizeof(Cluster);
+
+    // Allocated before the old table is released, so a failure leaves the old table usable
+#if defined(_WIN32)
+    auto *allocated = static_cast<Cluster *>(_aligned_malloc(bytes, alignof(Cluster)));
+#else
+    // Aligning to a huge page lets the kernel use them for the whole table
+    const size_t alignment = bytes >= HUGE_PAGE_SIZE ? HUGE_PAGE_SIZE : alignof(Cluster);
+    auto *allocated = static_cast<Cluster *>(std::aligned_alloc(alignment, bytes));
+#endif
+
+    if (allocated == nullptr)
+    {
+        throw ChessError("Could not allocate " + std::to_string(megabytes) + "MB for the transposition table");
+    }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (hugePages and bytes >= HUGE_PAGE_SIZE)
+    {
+        madvise(allocated, bytes, MADV_HUGEPAGE); // Only a hint, it's fine if the kernel says no
+    }
+#endif
+
+    release();
+    m_clusters = allocated;
+    m_clusterCount = clusters;
+    m_bytes = bytes;
+    clear();
+}
+
+/** Remove every entry, must not be called while a search is using the table */
+void TranspositionTable::clear()
+{
+    std::memset(static_cast<void *>(m_clusters), 0, m_bytes);
+    m_generation = 0;
+}
+
+/** Age the table at the start of every search so old entries get replaced first */
+void TranspositionTable::newSearch() { m_generation = (m_generation + 1) & GENERATION_MASK; }
+
+/** Look up a position
+ *
+ * @param key Zobrist key of the position
+ * @param data Filled with the entry when it is found
+ * @return True if the position was found
+ */
+bool TranspositionTable::probe(uint64_t key, TTData &data) const
+{
+    const Cluster &cluster = getCluster(key);
+    for (const Entry &entry: cluster.entries)
+    {
+        const uint64_t value = load(entry.data);
+        if ((load(entry.key) ^ value) != key or getBound(value) == BOUND_NONE)
+        {
+            continue;
+        }
+
+        data.move = getMove(value);
+        data.score = static_cast<int16_t>(value >> SCORE_SHIFT);
+        data.eval = static_cast<int16_t>(value >> EVAL_SHIFT);
+        data.depth = getDepth(value);
+        data.bound = getBound(value);
+        return true;
+    }
+
+    return false;
+}
+
+/** Store a position
+ *
+ * Goes into the slot already holding the position if there is one, otherwise it replaces the
+ * entry that is worth the least, shallow entries from older searches first.
+ *
+ * @param key Zobrist key of the position
+ * @param move Best move found, NO_MOVE keeps the move already stored for the position
+ * @param score Score of the position
+ * @param eval Static evaluation of the position
+ * @param depth Depth the position was searched to
+ * @param bound What kind of score it is
+ */
+void TranspositionTable::store(uint64_t key, board::Move move, int score, int eval, int depth, Bound bound)
+{
+    Cluster &cluster = getCluster(key);
+
+    Entry *replace = &cluster.entries[0];
+    int worst = INT32_MAX;
+    for (Entry &entry: cluster.entries)
+    {
+        const uint64_t value = load(entry.data);
+        if ((load(entry.key) ^ value) == key or getBound(value) == BOUND_NONE)
+        {
+            // Keep a much deeper result for the same position unless it is stale
+            if (getBound(value) != BOUND_NONE and bound != BOUND_EXACT and depth + 4 < getDepth(value) and
+                getGeneration(value) == m_generation)
+            {
+                return;
+            }
+
+            // Don't lose a good move to a store that doesn't have one
+            if (move == board::NO_MOVE and getBound(value) != BOUND_NONE)
+            {
+                move = getMove(value);
+            }
+
+            replace = &entry;
+            break;
+        }
+
+        const int age = (GENERATION_MASK + 1 + m_generation - getGeneration(value)) & GENERATION_MASK;
+        const int worth = getDepth(value) - 8 * age;
+        if (worth < worst)
+        {
+            worst = worth;
+            replace = &entry;
+        }
+    }
+
+    const uint64_t data = pack(move, score, eval, depth, bound, m_generation);
+    save(replace->key, key ^ data);
+    save(replace->data, data);
+}
+
+/** Get how full the table is, sampled from the first thousand clusters
+ *
+ * @return Permille of entries written during the current search
+ */
+int TranspositionTable::getHashfull() const
+{
+    const size_t clusters = std::min<size_t>(1000, m_clusterCount);
+    int count = 0;
+    for (size_t j = 0; j < clusters; ++j)
+    {
+        for (const Entry &entry: m_clusters[j].entries)
+        {
+            const uint64_t value = load(entry.data);
+            count += getBound(value) != BOUND_NONE and getGeneration(value) == m_generation;
+        }
+    }
+
+    return static_cast<int>(count * 1000 / (clusters * 4));
+}
@@ -0,0 +1,491 @@
+/****************************************************************************
+ * MIT License
+ * Copyright (c) 2024 Matthew
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * uci.cpp - Universal Chess Interface front end
+ * @author Matthew Brown
+ * @date 10/17/2026
+ *****************************************************************************/
+#include "chess_engine/uci.h"
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chess_engine/board/move.h"
+#include "chess_engine/chess_error.h"
+
+namespace chessengine
+{
+
+namespace
+{
+
+constexpr const char *START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+/* Moves left to plan for when the GUI does not send movestogo */
+constexpr int DEFAULT_MOVES_TO_GO = 30;
+
+/** Find the legal move written in coordinate notation, like e2e4 or e7e8q
+ *
+ * @return The move, or NO_MOVE when it is not legal
+ */
+board::Move parseMove(ChessGame &game, const std::string &text)
+{
+    board::MoveList moves;
+    game.generateLegalMoves(moves);
+    for (const board::Move move: moves)
+    {
+        if (move.toString() == text)
+        {
+            return move;
+        }
+    }
+
+    return board::NO_MOVE;
+}
+
+/** Parse the value of a spin option, values above the maximum are lowered to it
+ *
+ * @param value Text of the value
+ * @param minimum Smallest value the option takes
+ * @param maximum Largest value the option takes
+ * @return The value in range
+ */
+long long parseSpin(const std::string &value, long long minimum, long long maximum) noexcept(false)
+{
+    const long long number = std::stoll(value);
+    if (number < minimum)
+    {
+        throw ChessError(value + " is below the minimum of " + std::to_string(minimum));
+    }
+
+    return std::min(number, maximum);
+}
+
+/** Read the rest of the line as the value of setoption, the value may contain spaces */
+std::string readRest(std::istringstream &stream)
+{
+    std::string rest;
+    std::getline(stream >> std::ws, rest);
+    return rest;
+}
+
+} // namespace
+
+Uci::Uci(std::ostream &output) : m_output(output) { m_game.createFromFEN(START_FEN); }
+
+/** Write a line to the GUI, safe to call from the search thread */
+void Uci::send(const std::string &line)
+{
+    const std::scoped_lock lock(m_outputMutex);
+    m_output << line << std::endl;
+}
+
+/** Let a search that ended early send its bestmove */
+void Uci::releaseBestMove()
+{
+    {
+        const std::scoped_lock lock(m_bestMoveMutex);
+        m_holdBestMove = false;
+    }
+    m_bestMoveCondition.notify_all();
+}
+
+/** Handle one line from the GUI
+ *
+ * @param line Command and its arguments
+ * @return False once the GUI asked to quit
+ */
+bool Uci::handleCommand(const std::string &line)
+{
+    std::istringstream stream(line);
+    std::string command;
+    stream >> command;
+
+    if (command == "uci")
+    {
+        handleUci();
+    }
+    else if (command == "isready")
+    {
+        // Answered right away, even while searching
+        send("readyok");
+    }
+    else if (command == "setoption")
+    {
+        handleSetOption(stream);
+    }
+    else if (command == "ucinewgame")
+    {
+        handleStop();
+        m_engine.wait();
+        m_engine.newGame();
+    }
+    else if (command == "position")
+    {
+        handlePosition(stream);
+    }
+    else if (command == "go")
+    {
+        handleGo(stream);
+    }
+    else if (command == "stop")
+    {
+        handleStop();
+    }
+    else if (command == "ponderhit")
+    {
+        handlePonderHit();
+    }
+    else if (command == "quit")
+    {
+        handleStop();
+        m_engine.wait();
+        return false;
+    }
+    else if (not command.empty())
+    {
+        send("info string Unknown command: " + command);
+    }
+
+    return true;
+}
+
+/** Handle commands until the GUI quits or the input ends */
+void Uci::run(std::istream &input)
+{
+    std::string line;
+    while (std::getline(input, line))
+    {
+        if (not handleCommand(line))
+        {
+            return;
+        }
+    }
+
+    // The input closed without a quit
+    handleStop();
+    m_engine.wait();
+}
+
+/** Wait for a search to finish and send its bestmove, an infinite or ponder search needs a stop first */
+void Uci::wait() { m_engine.wait(); }
+
+/** Identify the engine and list its options */
+void Uci::handleUci()
+{
+    send("id name Chess Engine");
+    send("id author Matthew Brown");
+    send("option name Hash type spin default 16 min 1 max 65536");
+    send("option name Threads type spin default 1 min 1 max 512");
+    send("option name Ponder type check default false");
+    send("option name EvalFile type string default <empty>");
+    send("option name Move Overhead type spin default 30 min 0 max 5000");
+    send("uciok");
+}
+
+/** setoption name <id> [value <x>], waits for a running search first */
+void Uci::handleSetOption(std::istringstream &stream)
+{
+    std::string token;
+    std::string name;
+    std::string value;
+    stream >> token;
+    if (token != "name")
+    {
+        send("info string Expected setoption name <id> [value <x>]");
+        return;
+    }
+
+    // Option names may contain spaces, like Move Overhead
+    while (stream >> token and token != "value")
+    {
+        name += (name.empty() ? "" : " ") + token;
+    }
+    value = readRest(stream);
+
+    m_engine.wait();
+    try
+    {
+        if (name == "Hash")
+        {
+            m_engine.setHashSize(parseSpin(value, 1, 65536));
+        }
+        else if (name == "Threads")
+        {
+            m_engine.setThreadCount(parseSpin(value, 1, 512));
+        }
+        else if (name == "EvalFile")
+        {
+            if (not value.empty() and value != "<empty>")
+            {
+                m_engine.loadNetwork(value);
+                send("info string Loaded network " + value);
+            }
+        }
+        else if (name == "Move Overhead")
+        {
+            m_moveOverhead = std::chrono::milliseconds(parseSpin(value, 0, 5000));
+        }
+        else if (name != "Ponder")
+        {
+            send("info string Unknown option: " + name);
+        }
+    }
+    catch (std::exception &e)
+    {
+        send("info string Could not set " + name + ": " + e.what());
+    }
+}
+
+/** position [startpos | fen <fen>] [moves <move>...] */
+void Uci::handlePosition(std::istringstream &stream)
+{
+    std::string token;
+    std::string fen;
+    stream >> token;
+    if (token == "startpos")
+    {
+        fen = START_FEN;
+        stream >> token;
+    }
+    else if (token == "fen")
+    {
+        while (stream >> token and token != "moves")
+        {
+            fen += (fen.empty() ? "" : " ") + token;
+        }
+    }
+    else
+    {
+        send("info string Expected position startpos or position fen <fen>");
+        return;
+    }
+
+    // The search works on a copy, so the position can change while it runs
+    try
+    {
+        m_game.createFromFEN(fen);
+    }
+    catch (std::exception &e)
+    {
+        send(std::string("info string Invalid FEN: ") + e.what());
+        m_game.createFromFEN(START_FEN);
+        return;
+    }
+
+    if (token != "moves")
+    {
+        return;
+    }
+
+    while (stream >> token)
+    {
+        const board::Move move = parseMove(m_game, token);
+        if (move == board::NO_MOVE)
+        {
+            send("info string Illegal move: " + token);
+            return;
+        }
+        m_game.makeMove(move);
+    }
+}
+
+/** go [searchmoves <move>...] [ponder] [wtime x] [btime x] [winc x] [binc x] [movestogo x] [depth x]
+ *     [nodes x] [mate x] [movetime x] [infinite]
+ *
+ * With a clock the search plans to use its share of the remaining time plus most of the increment,
+ * and may overrun that by up to four times when an iteration is still going. Without any limit it
+ * searches until stop. The bestmove of an infinite or ponder search is held back until stop or
+ * ponderhit, as the protocol asks.
+ */
+void Uci::handleGo(std::istringstream &stream)
+{
+    SearchLimits limits;
+    std::chrono::milliseconds time[2]{};
+    std::chrono::milliseconds increment[2]{};
+    int movesToGo = 0;
+    bool hasClock = false;
+    bool ponder = false;
+    bool infinite = false;
+
+    std::vector<std::string> tokens;
+    for (std::string token; stream >> token;)
+    {
+        tokens.push_back(token);
+    }
+
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        const std::string &token = tokens[i];
+        if (token == "searchmoves")
+        {
+            // The moves run until the next token that is not one
+            while (i + 1 < tokens.size())
+            {
+                const board::Move move = parseMove(m_game, tokens[i + 1]);
+                if (move == board::NO_MOVE)
+                {
+                    break;
+                }
+                limits.searchMoves.push_back(move);
+                ++i;
+            }
+        }
+        else if (token == "ponder")
+        {
+            ponder = true;
+        }
+        else if (token == "infinite")
+        {
+            infinite = true;
+        }
+        else
+        {
+            long long value = 0;
+            try
+            {
+                value = std::stoll(tokens.at(++i));
+            }
+            catch (std::exception &)
+            {
+                send("info string Expected a number after " + token);
+                return;
+            }
+
+            if (token == "wtime" or token == "btime")
+            {
+                time[token == "wtime"] = std::chrono::milliseconds(value);
+                hasClock = true;
+            }
+            else if (token == "winc" or token == "binc")
+            {
+                increment[token == "winc"] = std::chrono::milliseconds(value);
+            }
+            else if (token == "movestogo")
+            {
+                movesToGo = static_cast<int>(value);
+            }
+            else if (token == "depth")
+            {
+                limits.depth = std::clamp(static_cast<int>(value), 1, board::MAX_PLY - 1);
+            }
+            else if (token == "nodes")
+            {
+                limits.nodes = static_cast<uint64_t>(std::max(value, 1LL));
+            }
+            else if (token == "mate")
+            {
+                limits.mate = static_cast<int>(value);
+            }
+            else if (token == "movetime")
+            {
+                limits.moveTime = std::max(std::chrono::milliseconds(value) - m_moveOverhead,
+                                           std::chrono::milliseconds(1));
+            }
+            else
+            {
+                send("info string Unknown go limit: " + token);
+            }
+        }
+    }
+
+    if (hasClock and not infinite)
+    {
+        const bool color = m_game.getBoard()->whiteToMove;
+        const std::chrono::milliseconds available =
+                std::max(time[color] - m_moveOverhead, std::chrono::milliseconds(1));
+        const int moves = movesToGo > 0 ? std::min(movesToGo, DEFAULT_MOVES_TO_GO) : DEFAULT_MOVES_TO_GO;
+        const std::chrono::milliseconds soft = std::min(available / moves + increment[color] * 3 / 4, available);
+
+        limits.softTime = soft;
+        limits.moveTime = std::min(available, soft * 4);
+    }
+
+    // A bare go, or one with only searchmoves, searches until stop
+    if (not hasClock and limits.moveTime.count() == 0 and limits.nodes == 0 and limits.mate == 0 and
+        limits.depth == SearchLimits{}.depth)
+    {
+        infinite = true;
+    }
+
+    // Wait for the last search to finish and send its bestmove, before holding back the next one
+    handleStop();
+    m_engine.wait();
+
+    m_pondering.store(ponder);
+    if (ponder)
+    {
+        limits.pondering = &m_pondering;
+    }
+    m_infinite = infinite;
+    {
+        const std::scoped_lock lock(m_bestMoveMutex);
+        m_holdBestMove = infinite or ponder;
+    }
+
+    m_engine.startSearch(
+            m_game, limits, [this](const SearchInfo &info) { send("info " + info.toString()); },
+            [this](const SearchResult &result)
+            {
+                {
+                    std::unique_lock lock(m_bestMoveMutex);
+                    m_bestMoveCondition.wait(lock, [this] { return not m_holdBestMove; });
+                }
+
+                // A null move when there is nothing to play
+                if (result.bestMove == board::NO_MOVE)
+                {
+                    send("bestmove 0000");
+                    return;
+                }
+
+                std::string line = "bestmove " + result.bestMove.toString();
+                if (result.info.pv.size() > 1)
+                {
+                    line += " ponder " + result.info.pv[1].toString();
+                }
+                send(line);
+            });
+}
+
+/** Stop the search, it sends its bestmove from the search thread */
+void Uci::handleStop()
+{
+    m_pondering.store(false);
+    m_engine.stop();
+    releaseBestMove();
+}
+
+/** The opponent played the move pondered on, the search goes on with time limits counted from now */
+void Uci::handlePonderHit()
+{
+    m_pondering.store(false);
+    if (not m_infinite)
+    {
+        releaseBestMove();
+    }
+}
+
+} // namespace chessengine
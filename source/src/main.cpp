@@ -25,9 +25,190 @@
  * @date 5/21/2024
  *****************************************************************************/
 #include <iostream>
+#include <string>
 
+#include "chess_engine/chess_engine.h"
+#include "chess_engine/chess_game.h"
+#include "chess_engine/perft.h"
+#include "chess_engine/uci.h"
 #include "simplelogger.hpp"
 
+namespace
+{
+
+/** Run perft from the command line: perft [--threads N] [--hash MB] <depth> [fen]
+ *
+ * The FEN may be passed unquoted, the remaining arguments are joined back together.
+ * With more than one thread or a hash table the count is split across a thread pool.
+ *
+ * @return Exit code of the program
+ */
+int runPerftCommand(const int argc, char *argv[])
+{
+    unsigned threads = 1;
+    size_t hashMegabytes = 0;
+    int depth = -1;
+    std::string fen;
+
+    try
+    {
+        for (int i = 2; i < argc; ++i)
+        {
+            const std::string argument = argv[i];
+            if (argument == "--threads" and i + 1 < argc)
+            {
+                threads = std::stoul(argv[++i]);
+            }
+            else if (argument == "--hash" and i + 1 < argc)
+            {
+                hashMegabytes = std::stoul(argv[++i]);
+            }
+            else if (depth < 0)
+            {
+                depth = std::stoi(argument);
+            }
+            else
+            {
+                fen += (fen.empty() ? "" : " ") + argument;
+            }
+        }
+
+        if (depth < 0)
+        {
+            std::cerr << "Usage: " << argv[0] << " perft [--threads N] [--hash MB] <depth> [fen]" << std::endl;
+            return 1;
+        }
+
+        if (fen.empty())
+        {
+            fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+        }
+
+        chessengine::ChessGame game;
+        game.createFromFEN(fen);
+
+        if (threads > 1 or hashMegabytes > 0)
+        {
+            std::cout << chessengine::runParallelPerft(game, depth, threads, hashMegabytes).toString();
+        }
+        else
+        {
+            std::cout << chessengine::runPerft(game, depth, true).toString();
+        }
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "Error running perft: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/** Search a position from the command line: search [--depth N] [--movetime MS] [--hash MB] [--threads N] [fen]
+ *
+ * Prints a line for every finished iteration and the best move at the end. The selective search
+ * techniques can be turned off with --no-nmp, --no-lmr, --no-rfp, --no-futility and --no-check-ext,
+ * --nnue FILE evaluates with a network instead of the piece-square tables.
+ *
+ * @return Exit code of the program
+ */
+int runSearchCommand(const int argc, char *argv[])
+{
+    chessengine::SearchLimits limits;
+    size_t hashMegabytes = 16;
+    unsigned threads = 1;
+    chessengine::SearchOptions options;
+    std::string networkPath;
+    std::string fen;
+
+    try
+    {
+        for (int i = 2; i < argc; ++i)
+        {
+            const std::string argument = argv[i];
+            if (argument == "--depth" and i + 1 < argc)
+            {
+                limits.depth = std::stoi(argv[++i]);
+            }
+            else if (argument == "--movetime" and i + 1 < argc)
+            {
+                limits.moveTime = std::chrono::milliseconds(std::stoll(argv[++i]));
+            }
+            else if (argument == "--hash" and i + 1 < argc)
+            {
+                hashMegabytes = std::stoul(argv[++i]);
+            }
+            else if (argument == "--threads" and i + 1 < argc)
+            {
+                threads = std::stoul(argv[++i]);
+            }
+            else if (argument == "--nnue" and i + 1 < argc)
+            {
+                networkPath = argv[++i];
+            }
+            else if (argument == "--no-nmp")
+            {
+                options.nullMovePruning = false;
+            }
+            else if (argument == "--no-lmr")
+            {
+                options.lateMoveReductions = false;
+            }
+            else if (argument == "--no-rfp")
+            {
+                options.reverseFutilityPruning = false;
+            }
+            else if (argument == "--no-futility")
+            {
+                options.futilityPruning = false;
+            }
+            else if (argument == "--no-check-ext")
+            {
+                options.checkExtensions = false;
+            }
+            else
+            {
+                fen += (fen.empty() ? "" : " ") + argument;
+            }
+        }
+
+        // Without any limit the search would never end
+        if (limits.moveTime.count() == 0 and limits.depth == chessengine::SearchLimits{}.depth)
+        {
+            limits.depth = 8;
+        }
+
+        if (fen.empty())
+        {
+            fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+        }
+
+        chessengine::ChessGame game;
+        game.createFromFEN(fen);
+
+        chessengine::ChessEngine engine(hashMegabytes);
+        engine.setThreadCount(threads);
+        engine.setSearchOptions(options);
+        if (not networkPath.empty())
+        {
+            engine.loadNetwork(networkPath);
+        }
+        const chessengine::SearchResult result = engine.search(
+                game, limits, [](const chessengine::SearchInfo &info) { std::cout << info.toString() << std::endl; });
+        std::cout << "bestmove " << result.bestMove.toString() << std::endl;
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "Error running search: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+} // namespace
+
 int main(const int argc, char *argv[])
 {
     SL_CAPTURE_EXCEPTIONS();
@@ -48,7 +229,19 @@ int main(const int argc, char *argv[])
         SL_LOG_DEBUG("Argument [" + std::to_string(i) + std::string("] is ") + argv[i]);
     }
 
-    // Run the engine...
+    if (argc > 1 and std::string(argv[1]) == "perft")
+    {
+        return runPerftCommand(argc, argv);
+    }
+
+    if (argc > 1 and std::string(argv[1]) == "search")
+    {
+        return runSearchCommand(argc, argv);
+    }
+
+    // Without a subcommand the engine talks UCI to a GUI
+    chessengine::Uci uci(std::cout);
+    uci.run(std::cin);
 
     SL_LOG_DEBUG("Finished running the Chess Engine");
     return 0; // Not necessary, just looks cleaner to me
@@ -0,0 +1,195 @@
+/**
+ * @file attack_tables_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the precomputed attack tables
+ */
+#include "chess_engine/board/attack_tables.h"
+
+#include <bit>
+#include <utility>
+#include <random>
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+#include "tree_walker.h"
+
+using namespace chessengine::board;
+
+/** Slow ray walking version of the slider attacks to compare against */
+uint64_t walkRays(unsigned int square, uint64_t occupied, bool diagonal)
+{
+    const int directions[2][4][2] = {{{1, 0}, {-1, 0}, {0, 1}, {0, -1}}, {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}}};
+
+    uint64_t attacks = 0;
+    for (const auto &direction: directions[diagonal])
+    {
+        int rank = static_cast<int>(square / 8) + direction[0];
+        int column = static_cast<int>(square % 8) + direction[1];
+        while (rank >= 0 and rank < 8 and column >= 0 and column < 8)
+        {
+            attacks |= 1ull << (rank * 8 + column);
+            if (occupied & (1ull << (rank * 8 + column)))
+            {
+                break;
+            }
+
+            rank += direction[0];
+            column += direction[1];
+        }
+    }
+
+    return attacks;
+}
+
+template<SliderBackend Backend>
+void testSlidersMatchRayWalk()
+{
+    std::mt19937_64 random(12345);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        // Sparse and dense occupancies
+        const uint64_t occupied = i % 2 ? random() & random() : random() | random();
+        for (unsigned int square = 0; square < 64; ++square)
+        {
+            ASSERT_EQ(getRookAttacks<Backend>(square, occupied), walkRays(square, occupied, false));
+            ASSERT_EQ(getBishopAttacks<Backend>(square, occupied), walkRays(square, occupied, true));
+            ASSERT_EQ(getQueenAttacks<Backend>(square, occupied),
+                      walkRays(square, occupied, false) | walkRays(square, occupied, true));
+        }
+    }
+}
+
+TEST(AttackTablesTest, TestMagicSlidersMatchRayWalk)
+{
+    const SliderBackend backend = getSliderBackend();
+
+    ASSERT_TRUE(setSliderBackend(SliderBackend::MAGIC));
+    testSlidersMatchRayWalk<SliderBackend::MAGIC>();
+
+    setSliderBackend(backend);
+}
+
+TEST(AttackTablesTest, TestPextSlidersMatchRayWalk)
+{
+    if (!isPextSupported())
+    {
+        EXPECT_FALSE(setSliderBackend(SliderBackend::PEXT));
+        GTEST_SKIP() << "CPU does not support BMI2";
+    }
+
+    const SliderBackend backend = getSliderBackend();
+
+    ASSERT_TRUE(setSliderBackend(SliderBackend::PEXT));
+    testSlidersMatchRayWalk<SliderBackend::PEXT>();
+
+    setSliderBackend(backend);
+}
+
+/** Count the legal moves and checks over a short walk of every special move position */
+std::pair<size_t, size_t> countMovesAndChecks()
+{
+    size_t moveCount = 0;
+    size_t checkCount = 0;
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        chessengine::ChessGame game;
+        game.createFromFEN(fen);
+        walkTree(game, 3, [&](chessengine::ChessGame &node, Move) {
+            MoveList moves;
+            node.generateLegalMoves(moves);
+            moveCount += moves.getSize();
+            checkCount += node.isInCheck();
+        });
+    }
+
+    return {moveCount, checkCount};
+}
+
+TEST(AttackTablesTest, TestMoveGenerationMatchesAcrossBackends)
+{
+    if (!isPextSupported())
+    {
+        GTEST_SKIP() << "CPU does not support BMI2";
+    }
+
+    const SliderBackend backend = getSliderBackend();
+
+    ASSERT_TRUE(setSliderBackend(SliderBackend::MAGIC));
+    const auto magic = countMovesAndChecks();
+    ASSERT_TRUE(setSliderBackend(SliderBackend::PEXT));
+    const auto pext = countMovesAndChecks();
+
+    setSliderBackend(backend);
+
+    EXPECT_EQ(magic, pext);
+    EXPECT_GT(magic.second, 0u);
+}
+
+TEST(AttackTablesTest, TestExtractBits)
+{
+    if (!isPextSupported())
+    {
+        GTEST_SKIP() << "CPU does not support BMI2";
+    }
+
+    EXPECT_EQ(extractBits(0b101100, 0b111100), 0b1011u);
+    EXPECT_EQ(extractBits(0xff00ff00ff00ff00ull, 0x8000000000000001ull), 0b10u);
+}
+
+TEST(AttackTablesTest, TestSliderAttacksOnEmptyBoard)
+{
+    // Rook on a1 sees the whole first rank and a-file
+    const unsigned int a1 = ChessBoard::getSquareFromAlgebraic("a1");
+    withSliderBackend([&]<SliderBackend Backend>() {
+        EXPECT_EQ(getRookAttacks<Backend>(a1, 0), (0xffull | 0x8080808080808080ull) & ~(1ull << a1));
+
+        // Bishop on d4 sees 13 squares
+        EXPECT_EQ(std::popcount(getBishopAttacks<Backend>(ChessBoard::getSquareFromAlgebraic("d4"), 0)), 13);
+    });
+}
+
+TEST(AttackTablesTest, TestSliderAttacksStopAtBlockers)
+{
+    const unsigned int a1 = ChessBoard::getSquareFromAlgebraic("a1");
+    const uint64_t blocker = 1ull << ChessBoard::getSquareFromAlgebraic("a3");
+
+    const uint64_t attacks = withSliderBackend([&]<SliderBackend Backend>() {
+        return getRookAttacks<Backend>(a1, blocker);
+    });
+    EXPECT_TRUE(attacks & blocker);
+    EXPECT_FALSE(attacks & (1ull << ChessBoard::getSquareFromAlgebraic("a4")));
+    EXPECT_TRUE(attacks & (1ull << ChessBoard::getSquareFromAlgebraic("h1")));
+}
+
+/** Count every attack in a leaper table */
+constexpr int countAttacks(const std::array<uint64_t, 64> &table)
+{
+    int count = 0;
+    for (const uint64_t attacks: table)
+    {
+        count += std::popcount(attacks);
+    }
+    return count;
+}
+
+// The leaper tables are built by the compiler
+static_assert(countAttacks(KNIGHT_ATTACKS) == 336);
+static_assert(countAttacks(KING_ATTACKS) == 420);
+static_assert(countAttacks(WHITE_PAWN_ATTACKS) == 98);
+static_assert(countAttacks(BLACK_PAWN_ATTACKS) == 98);
+
+TEST(AttackTablesTest, TestLeaperAttacks)
+{
+    auto square = [](const std::string &name) { return ChessBoard::getSquareFromAlgebraic(name); };
+    auto bit = [&](const std::string &name) { return 1ull << square(name); };
+
+    EXPECT_EQ(KNIGHT_ATTACKS[square("a1")], bit("b3") | bit("c2"));
+    EXPECT_EQ(KNIGHT_ATTACKS[square("h8")], bit("g6") | bit("f7"));
+    EXPECT_EQ(KING_ATTACKS[square("h1")], bit("g1") | bit("g2") | bit("h2"));
+    EXPECT_EQ(getPawnAttacks(true, square("a2")), bit("b3"));
+    EXPECT_EQ(getPawnAttacks(true, square("e4")), bit("d5") | bit("f5"));
+    EXPECT_EQ(getPawnAttacks(false, square("h7")), bit("g6"));
+    EXPECT_EQ(getPawnAttacks(false, square("e4")), bit("d3") | bit("f3"));
+}
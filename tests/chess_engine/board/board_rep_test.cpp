@@ -21,6 +21,42 @@ TEST(BitboardTest, GetBitCount)
     EXPECT_EQ(bb.getBitCount(), 2);
 }
 
+TEST(BitboardTest, BitScan)
+{
+    Bitboard bb(0b10010100);
+    EXPECT_EQ(bb.getLsb(), 2);
+    EXPECT_EQ(bb.getMsb(), 7);
+
+    EXPECT_EQ(bb.popLsb(), 2);
+    EXPECT_EQ(bb.popLsb(), 4);
+    EXPECT_EQ(bb.value, 0b10000000u);
+    EXPECT_EQ(bb.popLsb(), 7);
+    EXPECT_TRUE(bb.isEmpty());
+
+    uint64_t raw = 1ull << 63 | 1ull;
+    EXPECT_EQ(popLsb(raw), 0);
+    EXPECT_EQ(popLsb(raw), 63);
+    EXPECT_EQ(raw, 0u);
+
+    static_assert(Bitboard(0xf0).getBitCount() == 4);
+    static_assert(Bitboard(1ull << 40).getLsb() == 40);
+}
+
+TEST(BitboardTest, IterateSquares)
+{
+    std::vector<int> squares;
+    for (const int square: Bitboard(1ull << 63 | 1ull << 17 | 1ull))
+    {
+        squares.push_back(square);
+    }
+    EXPECT_EQ(squares, std::vector<int>({0, 17, 63}));
+
+    for ([[maybe_unused]] const int square: Bitboard())
+    {
+        FAIL() << "Empty bitboard has no squares";
+    }
+}
+
 TEST(BoardRepTest, CreateFromFEN)
 {
     ChessBoard board;
@@ -114,9 +150,9 @@ TEST(ChessGameTest, GetPiece)
 
     EXPECT_EQ(game.getPieceCount(), 30);
 
-    ASSERT_NE(game.getPiece(7), nullptr);
-    EXPECT_EQ(game.getPiece(7)->getType(), PieceType::ROOK);
-    EXPECT_EQ(game.getPiece(7)->getColor(), WHITE);
+    ASSERT_TRUE(game.getPiece(7).isValid());
+    EXPECT_EQ(game.getPiece(7).getType(), PieceType::ROOK);
+    EXPECT_EQ(game.getPiece(7).getColor(), WHITE);
 
-    EXPECT_NE(game.getPiece(1), nullptr);
+    EXPECT_TRUE(game.getPiece(1).isValid());
 }
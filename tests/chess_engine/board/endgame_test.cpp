@@ -0,0 +1,139 @@
+/**
+ * @file endgame_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the material table and the specialized endgame evaluation
+ */
+#include "chess_engine/board/endgame.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/material.h"
+#include "chess_engine/board/pawn_structure.h"
+#include "chess_engine/chess_error.h"
+#include "chess_engine/chess_game.h"
+#include "chess_engine/search.h"
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+/** Evaluate a FEN with the material and pawn tables */
+int evaluateEndgame(const std::string &fen)
+{
+    ChessGame game;
+    game.createFromFEN(fen);
+
+    PawnTable pawnTable;
+    MaterialTable materialTable;
+    return game.evaluate(&pawnTable, &materialTable);
+}
+
+TEST(EndgameTest, TestMaterialKey)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("8/8/4k3/8/2p5/8/8/1R2K3 w - - 0 1"));
+    EXPECT_EQ(game.getMaterialKey(), computeMaterialKey("KRKP", WHITE));
+    EXPECT_NE(game.getMaterialKey(), computeMaterialKey("KRKP", BLACK));
+    EXPECT_EQ(computeMaterialKey("KPK", BLACK), computeMaterialKey("KKP", WHITE));
+
+    // Where the pieces stand doesn't matter
+    ASSERT_NO_THROW(game.createFromFEN("1R6/8/8/8/8/5p2/2k5/4K3 b - - 0 1"));
+    EXPECT_EQ(game.getMaterialKey(), computeMaterialKey("KRKP", WHITE));
+
+    EXPECT_THROW((void) computeMaterialKey("RK", WHITE), ChessError);
+    EXPECT_THROW((void) computeMaterialKey("KXK", WHITE), ChessError);
+
+    ASSERT_NE(findEndgame(computeMaterialKey("KBNK", BLACK)), nullptr);
+    EXPECT_EQ(findEndgame(computeMaterialKey("KBNK", BLACK))->strongSide, BLACK);
+    EXPECT_EQ(findEndgame(computeMaterialKey("KNNK", WHITE)), nullptr);
+}
+
+TEST(EndgameTest, TestMaterialEntry)
+{
+    ChessGame game;
+    MaterialTable materialTable;
+    ASSERT_NO_THROW(game.createFromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+
+    const MaterialEntry &entry = materialTable.probe(*game.getBoard());
+    EXPECT_EQ(entry.phase, MAX_PHASE);
+    EXPECT_EQ(entry.imbalance, Score{});
+    EXPECT_EQ(entry.evaluationFunction, nullptr);
+    (void) materialTable.probe(*game.getBoard());
+    EXPECT_EQ(materialTable.getHits(), 1u);
+
+    // Only white has the bishop pair
+    ASSERT_NO_THROW(game.createFromFEN("rn1qkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+    EXPECT_EQ(materialTable.probe(*game.getBoard()).imbalance, BISHOP_PAIR);
+
+    // A lone minor piece can't win
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/8/3NK3 w - - 0 1"));
+    EXPECT_EQ(materialTable.probe(*game.getBoard()).scaleFactors[WHITE], SCALE_DRAW);
+    EXPECT_LT(std::abs(evaluateEndgame("4k3/8/8/8/8/8/8/3NK3 w - - 0 1")), 30);
+}
+
+TEST(EndgameTest, TestKPK)
+{
+    // King on the sixth in front of its pawn wins whoever is to move
+    EXPECT_GT(evaluateEndgame("4k3/8/4K3/4P3/8/8/8/8 w - - 0 1"), KNOWN_WIN);
+    EXPECT_LT(evaluateEndgame("4k3/8/4K3/4P3/8/8/8/8 b - - 0 1"), -KNOWN_WIN);
+    EXPECT_GT(evaluateEndgame("8/8/8/8/4p3/4k3/8/4K3 b - - 0 1"), KNOWN_WIN);
+
+    // Opposition in front of the pawn, a rook pawn and stalemate are draws
+    EXPECT_EQ(evaluateEndgame("8/8/8/8/8/4k3/4P3/4K3 w - - 0 1"), 0);
+    EXPECT_EQ(evaluateEndgame("k7/8/8/8/8/8/P7/K7 w - - 0 1"), 0);
+    EXPECT_EQ(evaluateEndgame("4k3/4P3/4K3/8/8/8/8/8 b - - 0 1"), 0);
+
+    // A pawn on g5 runs faster than a king on a8 can catch it, but not faster than one on e6
+    EXPECT_TRUE(probeKPK(0, 63, 33, true));
+    EXPECT_FALSE(probeKPK(0, 43, 33, false));
+}
+
+TEST(EndgameTest, TestKBNK)
+{
+    // The weak king is driven to a corner of the bishop's color, a1 and h8 for a dark bishop
+    const int darkCorner = evaluateEndgame("8/8/8/8/8/2N1B3/2K5/k7 w - - 0 1");
+    const int lightCorner = evaluateEndgame("K7/8/8/8/8/2N1B3/8/7k w - - 0 1");
+    const int center = evaluateEndgame("8/8/8/4k3/8/2N1B3/2K5/8 w - - 0 1");
+    EXPECT_GT(center, KNOWN_WIN);
+    EXPECT_GT(darkCorner, center);
+    EXPECT_LT(lightCorner, darkCorner);
+}
+
+TEST(EndgameTest, TestKRKP)
+{
+    // The king is in front of the pawn
+    const int won = evaluateEndgame("8/8/8/4k3/8/8/2p5/1RK5 w - - 0 1");
+    EXPECT_GT(won, 400);
+
+    // The pawn is about to queen with its king next to it and the rook side king is far away
+    const int drawish = evaluateEndgame("R7/8/8/8/8/8/2pk4/7K b - - 0 1");
+    EXPECT_LT(std::abs(drawish), won);
+}
+
+TEST(EndgameTest, TestOppositeBishops)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("4k3/4p3/8/2b5/8/8/3PP3/4KB2 w - - 0 1"));
+    EXPECT_EQ(scaleOppositeBishops(*game.getBoard(), WHITE), SCALE_NORMAL / 4);
+
+    MaterialTable materialTable;
+    EXPECT_EQ(materialTable.probe(*game.getBoard()).scaleFunctions[WHITE], scaleOppositeBishops);
+
+    // Bishops of the same color don't scale
+    ASSERT_NO_THROW(game.createFromFEN("4k3/4p3/8/1b6/8/8/3PP3/4KB2 w - - 0 1"));
+    EXPECT_EQ(scaleOppositeBishops(*game.getBoard(), WHITE), SCALE_NORMAL);
+}
+
+TEST(EndgameTest, TestSearchKnownDraw)
+{
+    // Every line keeps the opposition or trades down to bare kings
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("8/8/8/8/8/4k3/4P3/4K3 w - - 0 1"));
+
+    TranspositionTable transpositionTable(1);
+    std::atomic<bool> stop = false;
+    const auto search = std::make_unique<Search>(game, transpositionTable, stop);
+
+    SearchLimits limits;
+    limits.depth = 8;
+    EXPECT_EQ(search->run(limits).info.score, DRAW_SCORE);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file evaluation_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the tapered piece-square table evaluation
+ */
+#include "chess_engine/board/evaluation.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+#include "tree_walker.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+/** Compare the running evaluation with one computed from scratch */
+void checkEvaluation(ChessGame &game, Move)
+{
+    const ChessBoard &board = *game.getBoard();
+    ASSERT_EQ(board.psqtScore, computePieceSquareScore(board)) << game.getFEN();
+    ASSERT_EQ(board.phase, computePhase(board)) << game.getFEN();
+    ASSERT_EQ(evaluate(board), evaluateFromScratch(board)) << game.getFEN();
+}
+
+TEST(EvaluationTest, TestIncrementalEvaluation)
+{
+    ChessGame game;
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        const int score = evaluate(*game.getBoard());
+        walkTree(game, 3, checkEvaluation);
+        EXPECT_EQ(evaluate(*game.getBoard()), score);
+    }
+
+    // Passing keeps the score but not the side it is seen from
+    game.makeNullMove();
+    checkEvaluation(game, NO_MOVE);
+    game.unmakeNullMove();
+}
+
+TEST(EvaluationTest, TestEvaluate)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+    EXPECT_EQ(evaluate(*game.getBoard()), 0);
+
+    // A queen up is worth about a queen, seen from either side
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/8/3QK3 w - - 0 1"));
+    const int score = evaluate(*game.getBoard());
+    EXPECT_GT(score, 850);
+    EXPECT_LT(score, 1050);
+
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/8/3QK3 b - - 0 1"));
+    EXPECT_EQ(evaluate(*game.getBoard()), -score);
+
+    // The mirrored position scores the same for the other side
+    ASSERT_NO_THROW(game.createFromFEN("3qk3/8/8/8/8/8/8/4K3 b - - 0 1"));
+    EXPECT_EQ(evaluate(*game.getBoard()), score);
+
+    // A centralized knight is better than one in the corner
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/3N4/8/8/4K3 w - - 0 1"));
+    const int center = evaluate(*game.getBoard());
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/8/N3K3 w - - 0 1"));
+    EXPECT_GT(center, evaluate(*game.getBoard()));
+}
+
+TEST(EvaluationTest, TestPhase)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+    EXPECT_EQ(game.getBoard()->phase, MAX_PHASE);
+
+    // With only pawns and kings the endgame score is used
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/4P3/4K3 w - - 0 1"));
+    const ChessBoard &board = *game.getBoard();
+    EXPECT_EQ(board.phase, 0);
+    EXPECT_EQ(evaluate(board), board.psqtScore.eg);
+
+    EXPECT_EQ(taper({100, 0}, MAX_PHASE), 100);
+    EXPECT_EQ(taper({100, 0}, MAX_PHASE / 2), 50);
+}
@@ -59,8 +59,8 @@ bool testKingMovement(const std::string &fen, const std::string &square, const s
     }
 
     uint64_t moves = 0;
-    const auto *king = dynamic_cast<King *>(game.getPiece(ChessBoard::getSquareFromAlgebraic(square)));
-    if (king == nullptr)
+    const Piece king = game.getPiece(ChessBoard::getSquareFromAlgebraic(square));
+    if (king.getType() != PieceType::KING)
     {
         std::cerr << "Error testing king movement: Could not find king at square " << square << std::endl;
         return false;
@@ -69,7 +69,7 @@ bool testKingMovement(const std::string &fen, const std::string &square, const s
     game.pregenLegalMoves();
 
     std::vector<std::string> errorMoves;
-    king->getLegalMoves(moves); // Most important line of the function lo
+    king.getLegalMoves(moves); // Most important line of the function lo
 
     for (int i = 0; i < 64; ++i)
     {
@@ -113,7 +113,7 @@ bool testKingMovement(const std::string &fen, const std::string &square, const s
         printStuff(game.getBoard()->board.blackAttacks.value);
         printStuff(game.getBoard()->board.whitePieces.value);
         uint64_t attacks = 0;
-        king->getAttacks(attacks);
+        king.getAttacks(attacks);
         printStuff(attacks);
         std::cout << "---------------------------------" << std::endl;
 
@@ -129,7 +129,7 @@ TEST(KingTest, TestKingMovement)
 
 TEST(KingTest, TestKingGetType)
 {
-    EXPECT_EQ(King(true, nullptr, 0).getType(), PieceType::KING);
+    EXPECT_EQ(Piece(WHITE_KING, nullptr, 0).getType(), PieceType::KING);
 }
 
 TEST(KingTest, TestKingGetAttacks)
@@ -137,11 +137,11 @@ TEST(KingTest, TestKingGetAttacks)
     ChessGame game;
     ASSERT_NO_THROW(game.createFromFEN("r2q1rk1/2p1bppp/p2p1n2/1p2P3/4P1b1/1nP1BN2/PP3PPP/RN1QR1K1 w - - 1 12"));
 
-    auto king = dynamic_cast<King *>(game.getPiece(1));
-    ASSERT_NE(king, nullptr);
+    const Piece king = game.getPiece(1);
+    ASSERT_EQ(king.getType(), PieceType::KING);
 
     uint64_t attacks = 0;
-    king->getAttacks(attacks);
+    king.getAttacks(attacks);
 
     // TODO: Add expected attacks
     // EXPECT_EQ(attacks, );
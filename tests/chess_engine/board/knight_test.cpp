@@ -34,8 +34,8 @@ bool testKnightMovement(std::string fen, std::string square, std::vector<std::st
     }
 
     uint64_t moves = 0;
-    Knight *knight = dynamic_cast<Knight *>(game.getPiece(ChessBoard::getSquareFromAlgebraic(square)));
-    if (knight == nullptr)
+    const Piece knight = game.getPiece(ChessBoard::getSquareFromAlgebraic(square));
+    if (knight.getType() != PieceType::KNIGHT)
     {
         std::cerr << "Error testing knight movement: Could not find knight at square " << square << std::endl;
         return false;
@@ -44,7 +44,7 @@ bool testKnightMovement(std::string fen, std::string square, std::vector<std::st
     game.pregenLegalMoves();
 
     std::vector<std::string> errorMoves;
-    knight->getLegalMoves(moves);
+    knight.getLegalMoves(moves);
     for (int i = 0; i < 64; ++i)
     {
         if (moves & (1ull << i))
@@ -92,18 +92,18 @@ bool testKnightMovement(std::string fen, std::string square, std::vector<std::st
 
 TEST(KnightTest, TestKnightMovement) {}
 
-TEST(KnightTest, TestKnightGetType) { EXPECT_EQ(Knight(true, nullptr, 0).getType(), PieceType::KNIGHT); }
+TEST(KnightTest, TestKnightGetType) { EXPECT_EQ(Piece(WHITE_KNIGHT, nullptr, 0).getType(), PieceType::KNIGHT); }
 
 TEST(KnightTest, TestKnightGetAttacks)
 {
     ChessGame game;
     ASSERT_NO_THROW(game.createFromFEN("r2q1rk1/2p1bppp/p2p1n2/1p2P3/4P1b1/1nP1BN2/PP3PPP/RN1QR1K1 w - - 1 12"));
 
-    auto knight = dynamic_cast<Knight *>(game.getPiece(6));
-    ASSERT_NE(knight, nullptr);
+    const Piece knight = game.getPiece(6);
+    ASSERT_EQ(knight.getType(), PieceType::KNIGHT);
 
     uint64_t attacks = 0;
-    knight->getAttacks(attacks);
+    knight.getAttacks(attacks);
 
     // TODO: Add expected attacks
     // EXPECT_EQ(attacks, );
@@ -118,17 +118,26 @@ TEST(KnightTest, TestKnightGetLegalMoves)
 
     EXPECT_TRUE(testKnightMovement("8/6k1/4P3/q1PPn3/1N1B4/2KP1Nr1/3n4/4B1Q1 w - - 0 1", "b4", {}));
 
-    EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "g7",
-                                   {"e8", "e6", "f5", "h5"}));
+    // The bishop on c3 checks the king and no knight can take it, so none of the knights can move
+    EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "g7", {}));
     EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "b6", {}));
     EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "d6", {}));
     EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "e5", {}));
-    EXPECT_TRUE(
-            testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "c4", {"a5", "a3", "d2"}));
+    EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "c4", {}));
     EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "f4", {}));
     EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "e3", {}));
+    EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "b2", {}));
+
+    // Same position without the checking bishop
+    EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/4N3/1N6/b5b1 w - - 0 1", "g7",
+                                   {"e8", "e6", "f5", "h5"}));
     EXPECT_TRUE(
-            testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "b2", {"a4", "d1", "d3"}));
+            testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/4N3/1N6/b5b1 w - - 0 1", "c4", {"a5", "a3", "d2"}));
+    EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/2NK1Nq1/4N3/1N6/b5b1 w - - 0 1", "b2", {}));
+
+    // In check the knight can only block, and a pinned knight can't move at all
+    EXPECT_TRUE(testKnightMovement("4k3/8/8/1b6/8/8/8/2N2K2 w - - 0 1", "c1", {"d3", "e2"}));
+    EXPECT_TRUE(testKnightMovement("4k3/8/8/8/2b5/8/4N3/5K2 w - - 0 1", "e2", {}));
 
     EXPECT_TRUE(testKnightMovement("7q/b2r2N1/1N1N1b2/4N1k1/r1NK1Nq1/2b1N3/1N6/b5b1 w - - 0 1", "c4", {}));
 
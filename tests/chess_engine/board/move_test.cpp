@@ -0,0 +1,404 @@
+/**
+ * @file move_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the packed move type and legal move generation
+ */
+#include "chess_engine/board/move.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+#include "tree_walker.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+static_assert(sizeof(Move) == 2);
+
+TEST(MoveTest, TestMoveEncoding)
+{
+    const Move move(ChessBoard::getSquareFromAlgebraic("e7"), ChessBoard::getSquareFromAlgebraic("d8"),
+                    QUEEN_PROMOTION_CAPTURE);
+
+    EXPECT_EQ(move.getFrom(), ChessBoard::getSquareFromAlgebraic("e7"));
+    EXPECT_EQ(move.getTo(), ChessBoard::getSquareFromAlgebraic("d8"));
+    EXPECT_EQ(move.getFlags(), QUEEN_PROMOTION_CAPTURE);
+    EXPECT_TRUE(move.isCapture());
+    EXPECT_TRUE(move.isPromotion());
+    EXPECT_FALSE(move.isCastle());
+    EXPECT_EQ(WHITE_KNIGHT + move.getPromotionOffset(), WHITE_QUEEN);
+    EXPECT_EQ(move.toString(), "e7d8q");
+
+    EXPECT_FALSE(Move(3, 1, KING_CASTLE).isCapture());
+    EXPECT_TRUE(Move(3, 1, KING_CASTLE).isCastle());
+    EXPECT_TRUE(Move(36, 43, EN_PASSANT).isCapture());
+    EXPECT_EQ(Move(11, 27, DOUBLE_PAWN_PUSH).toString(), "e2e4");
+}
+
+TEST(MoveTest, TestMoveList)
+{
+    MoveList moves;
+    EXPECT_TRUE(moves.isEmpty());
+
+    moves.add(11, 27, DOUBLE_PAWN_PUSH);
+    moves.add(Move(1, 18));
+    EXPECT_EQ(moves.getSize(), 2);
+    EXPECT_EQ(moves[1], Move(1, 18));
+    EXPECT_TRUE(moves.contains(Move(11, 27, DOUBLE_PAWN_PUSH)));
+    EXPECT_FALSE(moves.contains(Move(11, 27)));
+
+    moves.clear();
+    EXPECT_TRUE(moves.isEmpty());
+}
+
+unsigned countLegalMoves(const std::string &fen)
+{
+    ChessGame game;
+    game.createFromFEN(fen);
+
+    MoveList moves;
+    game.generateLegalMoves(moves);
+    return moves.getSize();
+}
+
+TEST(MoveTest, TestGenerateLegalMoves)
+{
+    // Depth one counts of the usual perft positions
+    EXPECT_EQ(countLegalMoves("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"), 20);
+    EXPECT_EQ(countLegalMoves("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"), 48);
+    EXPECT_EQ(countLegalMoves("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"), 14);
+    EXPECT_EQ(countLegalMoves("r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"), 6);
+    EXPECT_EQ(countLegalMoves("rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8"), 44);
+    EXPECT_EQ(countLegalMoves("r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"), 46);
+
+    // Black to move, castling both ways and a double check
+    EXPECT_EQ(countLegalMoves("r3k2r/8/8/8/8/8/8/4K3 b kq - 0 1"), 26);
+    EXPECT_EQ(countLegalMoves("4k3/8/8/8/1b6/8/3N4/r3K3 w - - 0 1"), 2);
+}
+
+TEST(MoveTest, TestGenerateCastling)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1"));
+
+    MoveList moves;
+    game.generateLegalMoves(moves);
+    EXPECT_TRUE(moves.contains(Move(3, 1, KING_CASTLE)));
+    EXPECT_TRUE(moves.contains(Move(3, 5, QUEEN_CASTLE)));
+
+    // The rook on f8 covers f1 so only queenside castling is allowed
+    ASSERT_NO_THROW(game.createFromFEN("r3kr2/8/8/8/8/8/8/R3K2R w KQq - 0 1"));
+    game.generateLegalMoves(moves);
+    EXPECT_FALSE(moves.contains(Move(3, 1, KING_CASTLE)));
+    EXPECT_TRUE(moves.contains(Move(3, 5, QUEEN_CASTLE)));
+}
+
+TEST(MoveTest, TestMakeUnmakeMove)
+{
+    const std::string fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN(fen));
+
+    const Board before = game.getBoard()->board;
+
+    MoveList moves;
+    game.generateLegalMoves(moves);
+    for (const Move move: moves)
+    {
+        game.makeMove(move);
+        game.unmakeMove();
+
+        EXPECT_EQ(game.getFEN(), fen) << move.toString();
+        for (int j = 0; j < 12; ++j)
+        {
+            EXPECT_EQ(game.getBoard()->board.data[j].value, before.data[j].value) << move.toString();
+        }
+        EXPECT_EQ(game.getBoard()->board.allPieces.value, before.allPieces.value) << move.toString();
+        EXPECT_EQ(game.getBoard()->board.whitePieces.value, before.whitePieces.value) << move.toString();
+        EXPECT_EQ(game.getBoard()->board.blackPieces.value, before.blackPieces.value) << move.toString();
+    }
+}
+
+TEST(MoveTest, TestMakeSpecialMoves)
+{
+    auto square = [](const std::string &name) { return static_cast<unsigned>(ChessBoard::getSquareFromAlgebraic(name)); };
+
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1"));
+    game.makeMove(Move(square("e1"), square("g1"), KING_CASTLE));
+    EXPECT_EQ(game.getFEN(), "r3k2r/8/8/8/8/8/8/R4RK1 b kq - 1 1");
+    game.makeMove(Move(square("a8"), square("a1"), CAPTURE));
+    EXPECT_EQ(game.getFEN(), "4k2r/8/8/8/8/8/8/r4RK1 w k - 0 2");
+    game.unmakeMove();
+    game.unmakeMove();
+    EXPECT_EQ(game.getFEN(), "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1");
+
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/2p5/8/3P4/4K3 w - - 0 1"));
+    game.makeMove(Move(square("d2"), square("d4"), DOUBLE_PAWN_PUSH));
+    EXPECT_EQ(game.getFEN(), "4k3/8/8/8/2pP4/8/8/4K3 b - d3 0 1");
+    game.makeMove(Move(square("c4"), square("d3"), EN_PASSANT));
+    EXPECT_EQ(game.getFEN(), "4k3/8/8/8/8/3p4/8/4K3 w - - 0 2");
+
+    ASSERT_NO_THROW(game.createFromFEN("1n2k3/P7/8/8/8/8/8/4K3 w - - 0 1"));
+    game.makeMove(Move(square("a7"), square("b8"), KNIGHT_PROMOTION_CAPTURE));
+    EXPECT_EQ(game.getFEN(), "1N2k3/8/8/8/8/8/8/4K3 b - - 0 1");
+    EXPECT_EQ(game.getPiece(square("b8")).getType(), PieceType::KNIGHT);
+    game.unmakeMove();
+    EXPECT_EQ(game.getFEN(), "1n2k3/P7/8/8/8/8/8/4K3 w - - 0 1");
+}
+
+/** Check that every mailbox square agrees with the bitboards */
+bool isMailboxInSync(const Board &board)
+{
+    for (unsigned square = 0; square < 64; ++square)
+    {
+        PieceLoc expected = NO_PIECE;
+        for (int j = 0; j < 12; ++j)
+        {
+            if (board.data[j].value & 1ull << square)
+            {
+                expected = static_cast<PieceLoc>(j);
+            }
+        }
+
+        if (board.getPieceAt(square) != expected)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST(MoveTest, TestMailboxMatchesBitboards)
+{
+    ChessGame game;
+    EXPECT_EQ(game.getPiece(0).getPieceLoc(), NO_PIECE);
+
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        walkTree(game, 3,
+                 [](ChessGame &node, Move move)
+                 { ASSERT_TRUE(isMailboxInSync(node.getBoard()->board)) << move.toString(); });
+        EXPECT_TRUE(isMailboxInSync(game.getBoard()->board));
+    }
+}
+
+uint64_t countNodes(ChessGame &game, int depth)
+{
+    MoveList moves;
+    game.generateLegalMoves(moves);
+    if (depth == 1)
+    {
+        return moves.getSize();
+    }
+
+    uint64_t nodes = 0;
+    for (const Move move: moves)
+    {
+        game.makeMove(move);
+        nodes += countNodes(game, depth - 1);
+        game.unmakeMove();
+    }
+
+    return nodes;
+}
+
+TEST(MoveTest, TestMakeMoveNodeCounts)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+    EXPECT_EQ(countNodes(game, 2), 2039);
+
+    ASSERT_NO_THROW(game.createFromFEN("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+    EXPECT_EQ(countNodes(game, 3), 2812);
+}
+
+TEST(MoveTest, TestCheckAndDraws)
+{
+    auto square = [](const std::string &name) { return static_cast<unsigned>(ChessBoard::getSquareFromAlgebraic(name)); };
+
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/8/R3K3 b - - 0 1"));
+    EXPECT_FALSE(game.isInCheck());
+    ASSERT_NO_THROW(game.createFromFEN("R3k3/8/8/8/8/8/8/4K3 b - - 0 1"));
+    EXPECT_TRUE(game.isInCheck());
+
+    ASSERT_NO_THROW(game.createFromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+    game.makeMove(Move(square("g1"), square("f3")));
+    game.makeMove(Move(square("g8"), square("f6")));
+    game.makeMove(Move(square("f3"), square("g1")));
+    EXPECT_FALSE(game.isRepetition());
+    game.makeMove(Move(square("f6"), square("g8")));
+    EXPECT_TRUE(game.isRepetition());
+    EXPECT_TRUE(game.isDraw());
+
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/8/R3K3 w - - 100 80"));
+    EXPECT_TRUE(game.isDraw());
+}
+
+/** Compare the captures generator with the captures and promotions among all legal moves */
+void checkCaptures(ChessGame &game, Move)
+{
+    MoveList moves;
+    game.generateLegalMoves(moves);
+
+    MoveList captures;
+    game.generateCaptures(captures);
+
+    unsigned expected = 0;
+    for (const Move move: moves)
+    {
+        if (move.isCapture() or move.isPromotion())
+        {
+            ++expected;
+            ASSERT_TRUE(captures.contains(move)) << "Missing capture " << move.toString() << " in " << game.getFEN();
+        }
+    }
+
+    ASSERT_EQ(captures.getSize(), expected) << game.getFEN();
+}
+
+TEST(MoveTest, TestGenerateCaptures)
+{
+    ChessGame game;
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        walkTree(game, 2, checkCaptures);
+    }
+
+    ASSERT_NO_THROW(game.createFromFEN("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+    walkTree(game, 3, checkCaptures);
+
+    // Only the pawn can capture, and only en passant
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1"));
+    MoveList captures;
+    game.generateCaptures(captures);
+    ASSERT_EQ(captures.getSize(), 1);
+    EXPECT_EQ(captures[0].getFlags(), EN_PASSANT);
+}
+
+/** Check that the quiet moves and the captures together are exactly the legal moves */
+void checkQuiets(ChessGame &game, Move)
+{
+    MoveList moves;
+    game.generateLegalMoves(moves);
+
+    MoveList captures;
+    game.generateCaptures(captures);
+
+    MoveList quiets;
+    game.generateQuiets(quiets);
+
+    for (const Move move: quiets)
+    {
+        ASSERT_FALSE(move.isCapture() or move.isPromotion() or !moves.contains(move) or captures.contains(move))
+                << "Wrong quiet move " << move.toString() << " in " << game.getFEN();
+    }
+
+    ASSERT_EQ(quiets.getSize() + captures.getSize(), moves.getSize()) << game.getFEN();
+}
+
+TEST(MoveTest, TestGenerateQuiets)
+{
+    ChessGame game;
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        walkTree(game, 2, checkQuiets);
+    }
+
+    ASSERT_NO_THROW(game.createFromFEN("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+    walkTree(game, 3, checkQuiets);
+
+    // En passant is a capture even though its target square is empty
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1"));
+    MoveList quiets;
+    game.generateQuiets(quiets);
+    for (const Move move: quiets)
+    {
+        EXPECT_NE(move.getFlags(), EN_PASSANT);
+    }
+}
+
+/** Check that isLegal accepts exactly the generated moves out of a pool of moves from other positions */
+void checkIsLegal(ChessGame &game, const MoveList &pool)
+{
+    MoveList moves;
+    game.generateLegalMoves(moves);
+
+    for (const Move move: pool)
+    {
+        ASSERT_EQ(game.isLegal(move), moves.contains(move))
+                << "isLegal is wrong for " << move.toString() << " in " << game.getFEN();
+    }
+}
+
+TEST(MoveTest, TestIsLegal)
+{
+    const char *fens[] = {
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b KQkq - 0 1",
+        "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1",
+    };
+
+    // Moves of every position and their replies, so the pool has every kind of flag
+    MoveList pool;
+    ChessGame game;
+    for (const char *fen: fens)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        MoveList moves;
+        game.generateLegalMoves(moves);
+        for (const Move move: moves)
+        {
+            if (!pool.contains(move) and pool.getSize() < MAX_MOVES)
+            {
+                pool.add(move);
+            }
+        }
+    }
+
+    EXPECT_FALSE(game.isLegal(NO_MOVE));
+    for (const char *fen: fens)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        walkTree(game, 2, [&pool](ChessGame &node, Move) { checkIsLegal(node, pool); });
+    }
+}
+
+TEST(MoveTest, TestNullMove)
+{
+    auto square = [](const std::string &name) { return static_cast<unsigned>(ChessBoard::getSquareFromAlgebraic(name)); };
+
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1"));
+    const uint64_t hashKey = game.getHashKey();
+    const std::string fen = game.getFEN();
+
+    // Passing gives up the en passant capture
+    game.makeNullMove();
+    EXPECT_EQ(game.getFEN(), "4k3/8/8/3pP3/8/8/8/4K3 b - - 1 1");
+    EXPECT_NE(game.getHashKey(), hashKey);
+
+    game.unmakeNullMove();
+    EXPECT_EQ(game.getHashKey(), hashKey);
+    EXPECT_EQ(game.getFEN(), fen);
+
+    // Positions before a null move don't count as repetitions
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/8/8/8/8/8/R3K3 w - - 0 1"));
+    game.makeMove(Move(square("a1"), square("a2")));
+    game.makeNullMove();
+    game.makeMove(Move(square("a2"), square("a1")));
+    game.makeNullMove();
+    EXPECT_FALSE(game.isRepetition());
+    game.unmakeNullMove();
+    game.unmakeMove();
+    game.unmakeNullMove();
+    game.unmakeMove();
+    EXPECT_EQ(game.getFEN(), "4k3/8/8/8/8/8/8/R3K3 w - - 0 1");
+}
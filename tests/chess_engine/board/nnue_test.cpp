@@ -0,0 +1,186 @@
+/**
+ * @file nnue_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the HalfKP network evaluation
+ */
+#include "chess_engine/board/nnue.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/board/evaluation.h"
+#include "chess_engine/chess_error.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+#include "tree_walker.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+/** Writes one random network for every test, no trained network ships with the engine */
+class NnueTest : public testing::Test
+{
+protected:
+    static inline std::string s_path;
+    static inline Network *s_network = nullptr;
+
+    static void SetUpTestSuite()
+    {
+        s_path = (std::filesystem::temp_directory_path() / "chess_engine_test.nnue").string();
+        Network::writeRandom(s_path, 42);
+        s_network = new Network(s_path);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete s_network;
+        s_network = nullptr;
+        std::filesystem::remove(s_path);
+    }
+};
+
+/** Compare the updated accumulator with one computed from scratch */
+void checkAccumulator(const ChessGame &game, const Network &network)
+{
+    Accumulator expected;
+    network.refresh(*game.getBoard(), WHITE, expected);
+    network.refresh(*game.getBoard(), BLACK, expected);
+    ASSERT_TRUE(game.getAccumulator() == expected) << game.getFEN();
+}
+
+TEST_F(NnueTest, TestLoad)
+{
+    EXPECT_TRUE(s_network->isLoaded());
+    EXPECT_EQ(std::filesystem::file_size(s_path), Network::getFileSize());
+
+    Network network;
+    EXPECT_FALSE(network.isLoaded());
+    EXPECT_THROW(network.load(s_path + ".missing"), ChessError);
+    EXPECT_FALSE(network.isLoaded());
+
+    // Right size, wrong magic
+    const std::string badPath = s_path + ".bad";
+    {
+        std::ifstream in(s_path, std::ios::binary);
+        std::ofstream out(badPath, std::ios::binary);
+        out << in.rdbuf();
+        out.seekp(0);
+        out.write("NOTANNUE", 8);
+    }
+    EXPECT_THROW(network.load(badPath), ChessError);
+    EXPECT_FALSE(network.isLoaded());
+
+    // Truncated
+    std::filesystem::resize_file(badPath, 1000);
+    EXPECT_THROW(network.load(badPath), ChessError);
+    std::filesystem::remove(badPath);
+}
+
+TEST_F(NnueTest, TestIncrementalUpdate)
+{
+    ChessGame game;
+    game.setNetwork(s_network);
+
+    const NodeCheck check = [](ChessGame &node, Move) { checkAccumulator(node, *s_network); };
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        const int score = game.evaluate();
+        walkTree(game, 3, check);
+        EXPECT_EQ(game.evaluate(), score);
+    }
+
+    // Passing keeps the accumulator, only the side it is read from changes
+    game.makeNullMove();
+    checkAccumulator(game, *s_network);
+    game.unmakeNullMove();
+    EXPECT_EQ(game.evaluate(), s_network->evaluate(game.getAccumulator(), game.getBoard()->whiteToMove));
+
+    // Moves made before the network was set are taken back with a refresh
+    game.setNetwork(nullptr);
+    MoveList moves;
+    game.generateLegalMoves(moves);
+    game.makeMove(moves[0]);
+    game.setNetwork(s_network);
+    game.unmakeMove();
+    walkTree(game, 1, check);
+}
+
+TEST_F(NnueTest, TestReservedAccumulatorsStayInPlace)
+{
+    ChessGame game;
+    game.createFromFEN(SPECIAL_MOVE_FENS[0]);
+    game.setNetwork(s_network);
+    game.reservePlies(MAX_PLY);
+
+    // Reallocating would move the accumulator of the root
+    const Accumulator *root = &game.getAccumulator();
+    walkTree(game, 3, [&](ChessGame &node, Move) {
+        const ptrdiff_t ply = &node.getAccumulator() - root;
+        ASSERT_TRUE(ply >= 0 and ply <= 3);
+    });
+    EXPECT_EQ(&game.getAccumulator(), root);
+}
+
+TEST_F(NnueTest, TestKernels)
+{
+    const std::string best = getNnueKernels().name;
+    const std::vector<const NnueKernels *> kernels = getAvailableNnueKernels();
+    ASSERT_FALSE(kernels.empty());
+    EXPECT_EQ(kernels.back()->name, std::string("scalar"));
+    EXPECT_THROW(setNnueKernels("not a kernel"), ChessError);
+
+    const std::vector<std::string> fens = {
+            "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+            "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+            "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+            "4k3/8/8/8/8/8/8/3QK3 b - - 0 1",
+    };
+
+    // Every instruction set computes exactly what the portable kernels compute
+    std::vector<int> expected;
+    std::vector<Accumulator> expectedAccumulators;
+    setNnueKernels("scalar");
+    for (const std::string &fen: fens)
+    {
+        ChessGame game;
+        game.setNetwork(s_network);
+        game.createFromFEN(fen);
+        expected.push_back(game.evaluate());
+        expectedAccumulators.push_back(game.getAccumulator());
+    }
+
+    for (const NnueKernels *kernel: kernels)
+    {
+        setNnueKernels(kernel->name);
+        for (size_t j = 0; j < fens.size(); ++j)
+        {
+            ChessGame game;
+            game.setNetwork(s_network);
+            game.createFromFEN(fens[j]);
+            EXPECT_TRUE(game.getAccumulator() == expectedAccumulators[j]) << kernel->name << " " << fens[j];
+            EXPECT_EQ(game.evaluate(), expected[j]) << kernel->name << " " << fens[j];
+        }
+    }
+
+    setNnueKernels(best);
+}
+
+TEST_F(NnueTest, TestEvaluate)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    // Without a network the piece-square tables evaluate
+    EXPECT_EQ(game.getNetwork(), nullptr);
+    EXPECT_EQ(game.evaluate(), evaluate(*game.getBoard()));
+
+    game.setNetwork(s_network);
+    const int score = game.evaluate();
+    EXPECT_LE(std::abs(score), NNUE_MAX_SCORE);
+    EXPECT_EQ(score, s_network->evaluate(game.getAccumulator(), true));
+
+    game.setNetwork(nullptr);
+    EXPECT_EQ(game.evaluate(), evaluate(*game.getBoard()));
+}
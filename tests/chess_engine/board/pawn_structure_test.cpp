@@ -0,0 +1,108 @@
+/**
+ * @file pawn_structure_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the pawn structure evaluation and the pawn hash table
+ */
+#include "chess_engine/board/pawn_structure.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/chess_game.h"
+#include "chess_engine/search.h"
+#include "gtest/gtest.h"
+#include "tree_walker.h"
+
+#include <memory>
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+/** Score the pawn structure of a FEN with an empty table */
+Score getPawnScore(const std::string &fen)
+{
+    ChessGame game;
+    game.createFromFEN(fen);
+
+    PawnTable pawnTable;
+    return evaluatePawns(*game.getBoard(), pawnTable);
+}
+
+/** Compare the pawn score from a table with one computed from scratch */
+void checkPawnTable(const ChessGame &game, PawnTable &pawnTable)
+{
+    PawnTable fresh(1);
+    ASSERT_EQ(evaluatePawns(*game.getBoard(), pawnTable), evaluatePawns(*game.getBoard(), fresh)) << game.getFEN();
+}
+
+TEST(PawnStructureTest, TestPawnTerms)
+{
+    // A lone pawn on the a file is isolated and passed
+    EXPECT_EQ(getPawnScore("4k3/8/8/8/8/8/P7/4K3 w - - 0 1"), ISOLATED_PAWN + PASSED_PAWN[1]);
+    EXPECT_EQ(getPawnScore("4k3/p7/8/8/8/8/8/4K3 w - - 0 1"), -(ISOLATED_PAWN + PASSED_PAWN[1]));
+
+    // Only the front pawn counts as doubled, both are passed
+    EXPECT_EQ(getPawnScore("4k3/8/8/8/8/P7/P7/4K3 w - - 0 1"),
+              ISOLATED_PAWN + ISOLATED_PAWN + DOUBLED_PAWN + PASSED_PAWN[1] + PASSED_PAWN[2]);
+
+    // e3 can't advance past the d5 pawn and no pawn can come to defend e4, d5 is isolated
+    EXPECT_EQ(getPawnScore("k7/8/8/3p4/3P4/4P3/8/7K w - - 0 1"), BACKWARD_PAWN - ISOLATED_PAWN);
+
+    // A pawn on the next file still stops a passed pawn
+    EXPECT_EQ(getPawnScore("4k3/8/1p6/8/8/8/P7/4K3 w - - 0 1"), Score{});
+}
+
+TEST(PawnStructureTest, TestPawnEntry)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("6k1/5ppp/8/1P6/8/8/5PPP/6K1 w - - 0 1"));
+
+    PawnTable pawnTable;
+    const Score score = evaluatePawns(*game.getBoard(), pawnTable);
+    const PawnEntry &entry = pawnTable.probe(*game.getBoard());
+
+    // b5 is the only passed pawn, the king shields cancel out
+    EXPECT_EQ(entry.passedPawns[WHITE], 1ull << ChessBoard::getSquareFromAlgebraic("b5"));
+    EXPECT_EQ(entry.passedPawns[BLACK], 0ull);
+    EXPECT_EQ(entry.shields[WHITE], PAWN_SHIELD[0] + PAWN_SHIELD[0] + PAWN_SHIELD[0]);
+    EXPECT_EQ(entry.shields[WHITE], entry.shields[BLACK]);
+    EXPECT_EQ(score, ISOLATED_PAWN + PASSED_PAWN[4]);
+
+    // b5 attacks a6 and c6 and every square in front of them
+    EXPECT_TRUE(entry.attackSpans[WHITE] >> ChessBoard::getSquareFromAlgebraic("a8") & 1);
+    EXPECT_FALSE(entry.attackSpans[WHITE] >> ChessBoard::getSquareFromAlgebraic("b6") & 1);
+    EXPECT_TRUE(entry.attackSpans[BLACK] >> ChessBoard::getSquareFromAlgebraic("e1") & 1);
+    EXPECT_EQ(pawnTable.getHits(), 1u);
+}
+
+TEST(PawnStructureTest, TestPawnTable)
+{
+    // Collisions in a tiny table must never return the wrong structure
+    ChessGame game;
+    PawnTable pawnTable(16);
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        walkTree(game, 3, [&pawnTable](ChessGame &node, Move) { checkPawnTable(node, pawnTable); });
+    }
+
+    pawnTable.clear();
+    EXPECT_EQ(pawnTable.getProbes(), 0u);
+}
+
+TEST(PawnStructureTest, TestHitRate)
+{
+    // Pawns move in only a few of the positions a middlegame search visits
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    TranspositionTable transpositionTable(16);
+    std::atomic<bool> stop = false;
+    const auto search = std::make_unique<Search>(game, transpositionTable, stop);
+
+    SearchLimits limits;
+    limits.depth = 6;
+    search->run(limits);
+
+    const PawnTable &pawnTable = search->getPawnTable();
+    ASSERT_GT(pawnTable.getProbes(), 1000u);
+    EXPECT_GT(static_cast<double>(pawnTable.getHits()) / static_cast<double>(pawnTable.getProbes()), 0.9);
+}
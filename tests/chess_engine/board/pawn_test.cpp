@@ -32,8 +32,8 @@ bool testPawnMovement(std::string fen, std::string square, std::vector<std::stri
     }
 
     uint64_t moves = 0;
-    Piece *pawn = game.getPiece(ChessBoard::getSquareFromAlgebraic(square));
-    if (pawn == nullptr or pawn->getType() != PieceType::PAWN)
+    const Piece pawn = game.getPiece(ChessBoard::getSquareFromAlgebraic(square));
+    if (pawn.getType() != PieceType::PAWN)
     {
         std::cerr << "Error testing pawn movement: " << square << std::endl;
         return false;
@@ -42,7 +42,7 @@ bool testPawnMovement(std::string fen, std::string square, std::vector<std::stri
     game.pregenLegalMoves();
 
     std::vector<std::string> errorMoves;
-    pawn->getLegalMoves(moves);
+    pawn.getLegalMoves(moves);
     for (int i = 0; i < 64; ++i)
     {
         if (moves & (1ull << i))
@@ -96,11 +96,11 @@ TEST(PawnTest, TestPawnGetAttacks)
     ChessGame game;
     ASSERT_NO_THROW(game.createFromFEN("r2q1rk1/2p1bppp/p2p1n2/1p2P3/4P1b1/1nP1BN2/PP3PPP/RN1QR1K1 w - - 1 12"));
 
-    auto pawn = dynamic_cast<Pawn *>(game.getPiece(9));
-    ASSERT_NE(pawn, nullptr);
+    const Piece pawn = game.getPiece(9);
+    ASSERT_EQ(pawn.getType(), PieceType::PAWN);
 
     uint64_t attacks = 0;
-    pawn->getAttacks(attacks);
+    pawn.getAttacks(attacks);
 
     EXPECT_EQ(attacks, (0b1ull << 16) | (0b1ull << 18));
 }
@@ -126,3 +126,14 @@ TEST(PawnTest, TestPawnGetLegalMoves)
     EXPECT_TRUE(testPawnMovement("K3QQQ1/1BQ4Q/5B2/3ppp2/R1npk1pp/3ppp1Q/4N3/1Q2Q3 w - - 0 1", "e5", {}));
     EXPECT_TRUE(testPawnMovement("K3QQQ1/1BQ4Q/5B2/3ppp2/R1npk1pp/3ppp1Q/4N3/1Q2Q3 w - - 0 1", "f5", {}));
 }
+
+TEST(PawnTest, TestPawnEnPassant)
+{
+    EXPECT_TRUE(testPawnMovement("8/8/8/1Pp5/8/8/8/K3k3 w - c6 0 1", "b5", {"b6", "c6"}));
+
+    // Taking en passant would leave both pawns off the fifth rank and expose the king to the rook
+    EXPECT_TRUE(testPawnMovement("8/8/8/KPp4r/8/8/8/4k3 w - c6 0 1", "b5", {"b6"}));
+
+    // The double pushed pawn gives check, so capturing it is the only pawn move
+    EXPECT_TRUE(testPawnMovement("8/8/8/1Pp5/3K4/8/8/7k w - c6 0 1", "b5", {"c6"}));
+}
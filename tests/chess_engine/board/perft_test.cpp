@@ -3,3 +3,127 @@
  * @author Matthew Brown
  * @brief Unit tests for the move generator class.
  */
+#include "chess_engine/perft.h"
+
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+
+uint64_t runPerftTest(const std::string &fen, int depth)
+{
+    ChessGame game;
+    game.createFromFEN(fen);
+    return perft(game, depth);
+}
+
+// Reference counts from https://www.chessprogramming.org/Perft_Results
+
+TEST(PerftTest, TestStartingPosition)
+{
+    const std::string fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+    EXPECT_EQ(runPerftTest(fen, 1), 20);
+    EXPECT_EQ(runPerftTest(fen, 2), 400);
+    EXPECT_EQ(runPerftTest(fen, 3), 8902);
+    EXPECT_EQ(runPerftTest(fen, 4), 197281);
+    EXPECT_EQ(runPerftTest(fen, 5), 4865609);
+}
+
+TEST(PerftTest, TestKiwipete)
+{
+    const std::string fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+    EXPECT_EQ(runPerftTest(fen, 1), 48);
+    EXPECT_EQ(runPerftTest(fen, 2), 2039);
+    EXPECT_EQ(runPerftTest(fen, 3), 97862);
+    EXPECT_EQ(runPerftTest(fen, 4), 4085603);
+}
+
+TEST(PerftTest, TestPosition3)
+{
+    const std::string fen = "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1";
+    EXPECT_EQ(runPerftTest(fen, 1), 14);
+    EXPECT_EQ(runPerftTest(fen, 2), 191);
+    EXPECT_EQ(runPerftTest(fen, 3), 2812);
+    EXPECT_EQ(runPerftTest(fen, 4), 43238);
+    EXPECT_EQ(runPerftTest(fen, 5), 674624);
+}
+
+TEST(PerftTest, TestPosition4)
+{
+    const std::string fen = "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1";
+    EXPECT_EQ(runPerftTest(fen, 1), 6);
+    EXPECT_EQ(runPerftTest(fen, 2), 264);
+    EXPECT_EQ(runPerftTest(fen, 3), 9467);
+    EXPECT_EQ(runPerftTest(fen, 4), 422333);
+
+    // Same position with the colors flipped
+    EXPECT_EQ(runPerftTest("r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1", 4), 422333);
+}
+
+TEST(PerftTest, TestPosition5)
+{
+    const std::string fen = "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8";
+    EXPECT_EQ(runPerftTest(fen, 1), 44);
+    EXPECT_EQ(runPerftTest(fen, 2), 1486);
+    EXPECT_EQ(runPerftTest(fen, 3), 62379);
+    EXPECT_EQ(runPerftTest(fen, 4), 2103487);
+}
+
+TEST(PerftTest, TestPosition6)
+{
+    const std::string fen = "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10";
+    EXPECT_EQ(runPerftTest(fen, 1), 46);
+    EXPECT_EQ(runPerftTest(fen, 2), 2079);
+    EXPECT_EQ(runPerftTest(fen, 3), 89890);
+    EXPECT_EQ(runPerftTest(fen, 4), 3894594);
+}
+
+TEST(PerftTest, TestDivide)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    const PerftResult result = runPerft(game, 2, true);
+    EXPECT_EQ(result.nodes, 2039);
+    ASSERT_EQ(result.divide.size(), 48);
+
+    uint64_t total = 0;
+    for (const auto &[move, nodes]: result.divide)
+    {
+        total += nodes;
+        if (move.toString() == "e1g1")
+        {
+            EXPECT_EQ(nodes, 43);
+        }
+    }
+    EXPECT_EQ(total, result.nodes);
+
+    EXPECT_EQ(game.getFEN(), "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+}
+
+TEST(PerftTest, TestParallelPerft)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    const PerftResult serial = runPerft(game, 4, true);
+    EXPECT_EQ(serial.nodes, 4085603);
+
+    for (const auto &[threads, hash]: {std::pair{1u, 0u}, {3u, 0u}, {3u, 4u}})
+    {
+        const PerftResult parallel = runParallelPerft(game, 4, threads, hash);
+        EXPECT_EQ(parallel.nodes, serial.nodes);
+        ASSERT_EQ(parallel.divide.size(), serial.divide.size());
+        for (size_t j = 0; j < serial.divide.size(); ++j)
+        {
+            EXPECT_EQ(parallel.divide[j], serial.divide[j]);
+        }
+    }
+
+    // Shallow depths don't split two plies down
+    EXPECT_EQ(runParallelPerft(game, 1, 2).nodes, 48);
+    EXPECT_EQ(runParallelPerft(game, 2, 2).nodes, 2039);
+
+    ASSERT_NO_THROW(game.createFromFEN("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"));
+    EXPECT_EQ(runParallelPerft(game, 6, 4, 16).nodes, 11030083);
+}
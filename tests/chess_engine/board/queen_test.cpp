@@ -13,18 +13,18 @@ using namespace chessengine::board;
 
 TEST(QueenTest, TestQueenMovement) {}
 
-TEST(QueenTest, TestQueenGetType) { EXPECT_EQ(Queen(true, nullptr, 0).getType(), PieceType::QUEEN); }
+TEST(QueenTest, TestQueenGetType) { EXPECT_EQ(Piece(WHITE_QUEEN, nullptr, 0).getType(), PieceType::QUEEN); }
 
 TEST(QueenTest, TestQueenGetAttacks)
 {
     ChessGame game;
     ASSERT_NO_THROW(game.createFromFEN("r2q1rk1/2p1bppp/p2p1n2/1p2P3/4P1b1/1nP1BN2/PP3PPP/RN1QR1K1 w - - 1 12"));
 
-    auto queen = dynamic_cast<Queen *>(game.getPiece(4));
-    ASSERT_NE(queen, nullptr);
+    const Piece queen = game.getPiece(4);
+    ASSERT_EQ(queen.getType(), PieceType::QUEEN);
 
     uint64_t attacks = 0;
-    queen->getAttacks(attacks);
+    queen.getAttacks(attacks);
 
     // TODO: Add expected attacks
     // EXPECT_EQ(attacks, );
@@ -13,18 +13,18 @@ using namespace chessengine::board;
 
 TEST(RookTest, TestRookMovement) {}
 
-TEST(RookTest, TestRookGetType) { EXPECT_EQ(Rook(true, nullptr, 0).getType(), PieceType::ROOK); }
+TEST(RookTest, TestRookGetType) { EXPECT_EQ(Piece(WHITE_ROOK, nullptr, 0).getType(), PieceType::ROOK); }
 
 TEST(RookTest, TestRookGetAttacks)
 {
     ChessGame game;
     ASSERT_NO_THROW(game.createFromFEN("r2q1rk1/2p1bppp/p2p1n2/1p2P3/4P1b1/1nP1BN2/PP3PPP/RN1QR1K1 w - - 1 12"));
 
-    auto rook = dynamic_cast<Rook *>(game.getPiece(7));
-    ASSERT_NE(rook, nullptr);
+    const Piece rook = game.getPiece(7);
+    ASSERT_EQ(rook.getType(), PieceType::ROOK);
 
     uint64_t attacks = 0;
-    rook->getAttacks(attacks);
+    rook.getAttacks(attacks);
 
     // TODO: Add expected attacks
     // EXPECT_EQ(attacks, );
@@ -0,0 +1,74 @@
+/**
+ * @file see_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the static exchange evaluation
+ */
+#include "chess_engine/board/see.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+/** Get the exact exchange value of a move by searching for the highest threshold it passes */
+int getExchangeValue(const std::string &fen, const std::string &from, const std::string &to, unsigned flags)
+{
+    ChessGame game;
+    game.createFromFEN(fen);
+
+    const Move move(ChessBoard::getSquareFromAlgebraic(from), ChessBoard::getSquareFromAlgebraic(to), flags);
+    int value = -2000;
+    while (value < 2000 and see(*game.getBoard(), move, value + 1))
+    {
+        ++value;
+    }
+
+    return value;
+}
+
+TEST(SeeTest, TestUndefendedCapture)
+{
+    EXPECT_EQ(getExchangeValue("1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1", "e1", "e5", CAPTURE), 100);
+}
+
+TEST(SeeTest, TestDefendedCapture)
+{
+    // Knight takes a pawn and is taken back
+    EXPECT_EQ(getExchangeValue("1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1", "d3", "e5", CAPTURE), -220);
+
+    // Queen takes a pawn defended by a pawn
+    EXPECT_EQ(getExchangeValue("4k3/8/3p4/4p3/8/8/8/4QK2 w - - 0 1", "e1", "e5", CAPTURE), -800);
+}
+
+TEST(SeeTest, TestXRay)
+{
+    // The second rook only attacks e5 once the first one has captured
+    EXPECT_EQ(getExchangeValue("4r1k1/8/8/4p3/8/8/4R3/4R1K1 w - - 0 1", "e2", "e5", CAPTURE), 100);
+
+    // Without it the rook is lost
+    EXPECT_EQ(getExchangeValue("4r1k1/8/8/4p3/8/8/4R3/6K1 w - - 0 1", "e2", "e5", CAPTURE), 100 - 500);
+
+    // A queen behind the capturing pawn wins the recapturing pawn
+    EXPECT_EQ(getExchangeValue("4k3/8/5p2/4p3/3P4/2Q5/8/4K3 w - - 0 1", "d4", "e5", CAPTURE), 100);
+    EXPECT_EQ(getExchangeValue("4k3/8/5p2/4p3/3P4/8/8/4K3 w - - 0 1", "d4", "e5", CAPTURE), 0);
+}
+
+TEST(SeeTest, TestKingRecapture)
+{
+    // The king can take back
+    EXPECT_EQ(getExchangeValue("8/8/8/3k4/4p3/3P4/8/4K3 w - - 0 1", "d3", "e4", CAPTURE), 0);
+
+    // The king can't take back a defended pawn
+    EXPECT_EQ(getExchangeValue("8/8/8/3k4/4p3/3P4/6B1/4K3 w - - 0 1", "d3", "e4", CAPTURE), 100);
+}
+
+TEST(SeeTest, TestSpecialMoves)
+{
+    EXPECT_EQ(getExchangeValue("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1", "e5", "d6", EN_PASSANT), 100);
+
+    // Quiet moves only lose material when the piece can be taken
+    EXPECT_EQ(getExchangeValue("4k3/8/3p4/8/8/8/8/3QK3 w - - 0 1", "d1", "e5", QUIET), -900);
+    EXPECT_EQ(getExchangeValue("4k3/8/8/8/8/8/8/3QK3 w - - 0 1", "d1", "d5", QUIET), 0);
+}
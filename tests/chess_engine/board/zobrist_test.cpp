@@ -0,0 +1,71 @@
+/**
+ * @file zobrist_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the Zobrist position keys
+ */
+#include "chess_engine/board/zobrist.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+#include "tree_walker.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+TEST(ZobristTest, TestIncrementalKeys)
+{
+    ChessGame game;
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        const uint64_t key = game.getHashKey();
+        walkTree(game, 3,
+                 [](ChessGame &node, Move)
+                 {
+                     ChessBoard fresh = *node.getBoard();
+                     fresh.generateHashKeys();
+                     ASSERT_EQ(node.getHashKey(), fresh.hashKey) << node.getFEN();
+                     ASSERT_EQ(node.getPawnKey(), fresh.pawnKey) << node.getFEN();
+                     ASSERT_EQ(node.getMaterialKey(), fresh.materialKey) << node.getFEN();
+                 });
+        EXPECT_EQ(game.getHashKey(), key);
+    }
+}
+
+TEST(ZobristTest, TestTranspositions)
+{
+    auto square = [](const std::string &name) { return static_cast<unsigned>(ChessBoard::getSquareFromAlgebraic(name)); };
+
+    ChessGame first;
+    ChessGame second;
+    ASSERT_NO_THROW(first.createFromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+    ASSERT_NO_THROW(second.createFromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+
+    first.makeMove(Move(square("g1"), square("f3")));
+    first.makeMove(Move(square("b8"), square("c6")));
+    first.makeMove(Move(square("b1"), square("c3")));
+
+    second.makeMove(Move(square("b1"), square("c3")));
+    second.makeMove(Move(square("b8"), square("c6")));
+    EXPECT_NE(first.getHashKey(), second.getHashKey()); // Different side to move
+    second.makeMove(Move(square("g1"), square("f3")));
+
+    EXPECT_EQ(first.getHashKey(), second.getHashKey());
+    EXPECT_EQ(first.getPawnKey(), second.getPawnKey());
+    EXPECT_EQ(first.getMaterialKey(), second.getMaterialKey());
+
+    // Only the pawns go into the pawn key
+    first.makeMove(Move(square("c6"), square("d4")));
+    EXPECT_NE(first.getHashKey(), second.getHashKey());
+    EXPECT_EQ(first.getPawnKey(), second.getPawnKey());
+
+    // Same pieces but different castling rights or en passant squares are different positions
+    ASSERT_NO_THROW(first.createFromFEN("r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1"));
+    ASSERT_NO_THROW(second.createFromFEN("r3k2r/8/8/8/8/8/8/R3K2R w KQk - 0 1"));
+    EXPECT_NE(first.getHashKey(), second.getHashKey());
+
+    ASSERT_NO_THROW(first.createFromFEN("4k3/8/8/2pP4/8/8/8/4K3 w - c6 0 1"));
+    ASSERT_NO_THROW(second.createFromFEN("4k3/8/8/2pP4/8/8/8/4K3 w - - 0 1"));
+    EXPECT_NE(first.getHashKey(), second.getHashKey());
+}
@@ -0,0 +1,116 @@
+/**
+ * @file copy_make_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the copy-make stack
+ */
+#include "chess_engine/copy_make.h"
+
+#include "chess_engine/board/nnue.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+#include "tree_walker.h"
+
+#include <filesystem>
+#include <vector>
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+namespace
+{
+
+/** Compare the top of the stack with the game, everything makeMove keeps up to date must match */
+void checkSameState(const CopyMakeStack &stack, const ChessGame &game)
+{
+    const ChessBoard &expected = *game.getBoard();
+    const ChessBoard &actual = stack.getBoard();
+
+    ASSERT_EQ(actual.getFEN(stack.getHalfMoveClock(), stack.getFullMoveClock()), game.getFEN());
+    ASSERT_EQ(actual.hashKey, expected.hashKey) << game.getFEN();
+    ASSERT_EQ(actual.pawnKey, expected.pawnKey) << game.getFEN();
+    ASSERT_EQ(actual.materialKey, expected.materialKey) << game.getFEN();
+    ASSERT_TRUE(actual.psqtScore == expected.psqtScore) << game.getFEN();
+    ASSERT_EQ(actual.phase, expected.phase) << game.getFEN();
+    for (unsigned square = 0; square < 64; ++square)
+    {
+        ASSERT_EQ(actual.board.getPieceAt(square), expected.board.getPieceAt(square)) << game.getFEN();
+    }
+
+    if (game.getNetwork() != nullptr)
+    {
+        ASSERT_TRUE(stack.getAccumulator() == game.getAccumulator()) << game.getFEN();
+    }
+}
+
+/** Copy-make every legal move of every position in the walk and compare it with make/unmake */
+void checkCopyMake(ChessGame &game)
+{
+    CopyMakeStack stack(game);
+    MoveList moves;
+    game.generateLegalMoves(moves);
+    for (const Move move: moves)
+    {
+        game.makeMove(move);
+        stack.makeMove(move);
+        checkSameState(stack, game);
+        game.unmakeMove();
+        stack.unmakeMove();
+
+        ASSERT_EQ(stack.getPly(), 0);
+        ASSERT_EQ(stack.getBoard().hashKey, game.getHashKey()) << move.toString();
+    }
+}
+
+} // namespace
+
+TEST(CopyMakeTest, TestSameStateAsMakeMove)
+{
+    for (const std::string &fen: SPECIAL_MOVE_FENS)
+    {
+        ChessGame game;
+        game.createFromFEN(fen);
+        walkTree(game, 2, [](ChessGame &node, Move) { checkCopyMake(node); });
+    }
+}
+
+TEST(CopyMakeTest, TestSameAccumulatorAsMakeMove)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "chess_engine_copy_make.nnue").string();
+    Network::writeRandom(path, 7);
+    const Network network(path);
+
+    ChessGame game;
+    game.createFromFEN(SPECIAL_MOVE_FENS[0]);
+    game.setNetwork(&network);
+    walkTree(game, 1, [](ChessGame &node, Move) { checkCopyMake(node); });
+
+    std::filesystem::remove(path);
+}
+
+TEST(CopyMakeTest, TestLineOfMoves)
+{
+    ChessGame game;
+    game.createFromFEN(SPECIAL_MOVE_FENS[0]);
+    CopyMakeStack stack(game);
+
+    // Follow the first legal move for a few plies, every parent stays in its slot
+    std::vector<uint64_t> keys;
+    for (int ply = 0; ply < 6; ++ply)
+    {
+        keys.push_back(game.getHashKey());
+
+        MoveList moves;
+        game.generateLegalMoves(moves);
+        ASSERT_FALSE(moves.isEmpty());
+        game.makeMove(moves[0]);
+        stack.makeMove(moves[0]);
+        checkSameState(stack, game);
+    }
+
+    EXPECT_EQ(stack.getPly(), 6);
+    while (stack.getPly() > 0)
+    {
+        stack.unmakeMove();
+        EXPECT_EQ(stack.getBoard().hashKey, keys[stack.getPly()]);
+    }
+}
@@ -0,0 +1,169 @@
+/**
+ * @file move_picker_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the staged move picker and the history table
+ */
+#include "chess_engine/move_picker.h"
+
+#include "chess_engine/board/chess_board.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+namespace
+{
+
+unsigned square(const std::string &name)
+{
+    return ChessBoard::getSquareFromAlgebraic(name);
+}
+
+/** Take every move from a picker, checking the stages never go back */
+MoveList pickAll(MovePicker &picker)
+{
+    MoveList picked;
+    MovePicker::Stage stage = picker.getStage();
+    for (Move move = picker.nextMove(); move != NO_MOVE; move = picker.nextMove())
+    {
+        EXPECT_GE(picker.getStage(), stage);
+        stage = picker.getStage();
+        picked.add(move);
+    }
+
+    EXPECT_EQ(picker.getStage(), MovePicker::DONE);
+    return picked;
+}
+
+} // namespace
+
+TEST(MovePickerTest, TestEveryMoveOnce)
+{
+    const char *fens[] = {
+        "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+        "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        "4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    };
+
+    const HistoryTable history;
+    ChessGame game;
+    for (const char *fen: fens)
+    {
+        ASSERT_NO_THROW(game.createFromFEN(fen));
+        MoveList moves;
+        game.generateLegalMoves(moves);
+
+        // The last legal move as the hash move, a quiet move and an impossible move as the killers
+        const Move ttMove = moves[moves.getSize() - 1];
+        Move killers[2] = {ttMove, Move(square("a1"), square("h8"))};
+        for (const Move move: moves)
+        {
+            if (!move.isCapture() and !move.isPromotion() and move != ttMove)
+            {
+                killers[0] = move;
+                break;
+            }
+        }
+
+        MovePicker picker(game, ttMove, killers, history);
+        const MoveList picked = pickAll(picker);
+
+        ASSERT_EQ(picked.getSize(), moves.getSize()) << fen;
+        EXPECT_EQ(picked[0], ttMove) << fen;
+        for (unsigned i = 0; i < picked.getSize(); ++i)
+        {
+            EXPECT_TRUE(moves.contains(picked[i])) << fen;
+            for (unsigned j = 0; j < i; ++j)
+            {
+                EXPECT_NE(picked[i], picked[j]) << fen;
+            }
+        }
+    }
+}
+
+TEST(MovePickerTest, TestStageOrder)
+{
+    ChessGame game;
+
+    // Bxd5 wins a pawn, Qxb6 loses the queen for a pawn
+    ASSERT_NO_THROW(game.createFromFEN("4k3/p7/1p6/3p4/8/1B6/5Q2/4K3 w - - 0 1"));
+
+    const HistoryTable history;
+    const Move killer(square("e1"), square("d1"));
+    const Move killers[2] = {killer, NO_MOVE};
+    MovePicker picker(game, NO_MOVE, killers, history);
+
+    EXPECT_EQ(picker.nextMove(), Move(square("b3"), square("d5"), CAPTURE));
+    EXPECT_EQ(picker.getStage(), MovePicker::GOOD_CAPTURES);
+
+    EXPECT_EQ(picker.nextMove(), killer);
+    EXPECT_EQ(picker.getStage(), MovePicker::KILLERS);
+
+    const MoveList rest = pickAll(picker);
+    ASSERT_FALSE(rest.isEmpty());
+    EXPECT_EQ(rest[rest.getSize() - 1], Move(square("f2"), square("b6"), CAPTURE));
+    for (unsigned i = 0; i + 1 < rest.getSize(); ++i)
+    {
+        EXPECT_FALSE(rest[i].isCapture());
+    }
+}
+
+TEST(MovePickerTest, TestHistoryOrdersQuiets)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+
+    const Move best(square("g1"), square("f3"));
+    const Move second(square("e2"), square("e4"), DOUBLE_PAWN_PUSH);
+    HistoryTable history;
+    history.update(WHITE, best, 2000);
+    history.update(WHITE, second, 1000);
+    history.update(BLACK, Move(square("a2"), square("a3")), 4000);
+
+    const Move killers[2] = {NO_MOVE, NO_MOVE};
+    MovePicker picker(game, NO_MOVE, killers, history);
+    EXPECT_EQ(picker.nextMove(), best);
+    EXPECT_EQ(picker.getStage(), MovePicker::QUIETS);
+    EXPECT_EQ(picker.nextMove(), second);
+}
+
+TEST(MovePickerTest, TestQuiescencePicker)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("4k3/p7/1p6/3p4/8/1B6/5Q1P/4K3 w - - 0 1"));
+
+    // Only the winning capture, no quiet moves and no losing captures
+    MovePicker picker(game);
+    const MoveList picked = pickAll(picker);
+    ASSERT_EQ(picked.getSize(), 1);
+    EXPECT_EQ(picked[0], Move(square("b3"), square("d5"), CAPTURE));
+}
+
+TEST(MovePickerTest, TestHistoryBounds)
+{
+    HistoryTable history;
+    const Move move(square("g1"), square("f3"));
+    EXPECT_EQ(history.get(WHITE, move), 0);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        history.update(WHITE, move, 5000);
+    }
+    EXPECT_GT(history.get(WHITE, move), 0);
+    EXPECT_LE(history.get(WHITE, move), MAX_HISTORY);
+    EXPECT_EQ(history.get(BLACK, move), 0);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        history.update(WHITE, move, -5000);
+    }
+    EXPECT_LT(history.get(WHITE, move), 0);
+    EXPECT_GE(history.get(WHITE, move), -MAX_HISTORY);
+
+    history.clear();
+    EXPECT_EQ(history.get(WHITE, move), 0);
+}
@@ -0,0 +1,173 @@
+/**
+ * @file search_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the alpha-beta search
+ */
+#include "chess_engine/search.h"
+
+#include "chess_engine/chess_engine.h"
+#include "chess_engine/chess_game.h"
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+/** Search a position to a fixed depth with a fresh engine */
+SearchResult searchPosition(const std::string &fen, int depth)
+{
+    ChessGame game;
+    game.createFromFEN(fen);
+
+    ChessEngine engine(1);
+    SearchLimits limits;
+    limits.depth = depth;
+    return engine.search(game, limits);
+}
+
+TEST(SearchTest, TestFindsMateInOne)
+{
+    const SearchResult result = searchPosition("6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1", 3);
+    EXPECT_EQ(result.bestMove.toString(), "d1d8");
+    EXPECT_EQ(result.info.score, MATE_SCORE - 1);
+    EXPECT_EQ(result.info.toString().substr(0, 17), "depth 3 seldepth ");
+    EXPECT_NE(result.info.toString().find(" score mate 1 nodes "), std::string::npos);
+}
+
+TEST(SearchTest, TestFindsMateInTwo)
+{
+    // The king has to take away the escape squares before the rook can mate
+    const SearchResult result = searchPosition("k7/8/2K5/8/8/8/8/7R w - - 0 1", 5);
+    ASSERT_GE(result.info.score, MATE_IN_MAX_PLY);
+    EXPECT_EQ(result.info.score, MATE_SCORE - 3);
+}
+
+TEST(SearchTest, TestWinsMaterial)
+{
+    const SearchResult result = searchPosition("4k3/8/8/3q4/8/8/8/3RK3 w - - 0 1", 3);
+    EXPECT_EQ(result.bestMove.toString(), "d1d5");
+    EXPECT_GT(result.info.score, 400);
+    ASSERT_FALSE(result.info.pv.empty());
+    EXPECT_EQ(result.info.pv.front(), result.bestMove);
+}
+
+TEST(SearchTest, TestQuiescence)
+{
+    // Taking the pawn loses the queen to the recapture, which only quiescence sees at depth 1
+    const SearchResult result = searchPosition("4k3/8/3p4/4p3/8/8/8/4QK2 w - - 0 1", 1);
+    EXPECT_NE(result.bestMove.toString(), "e1e5");
+
+    // About a queen against two pawns, the squares the pieces stand on move it a little
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("4k3/8/3p4/4p3/8/8/8/4QK2 w - - 0 1"));
+    EXPECT_GT(result.info.score, 600);
+    EXPECT_LT(result.info.score, evaluate(*game.getBoard()) + 100);
+
+    // A loose piece is still won
+    const SearchResult capture = searchPosition("4k3/8/8/4n3/8/8/8/4QK2 w - - 0 1", 1);
+    EXPECT_EQ(capture.bestMove.toString(), "e1e5");
+}
+
+TEST(SearchTest, TestGameOverAtRoot)
+{
+    const SearchResult stalemate = searchPosition("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1", 4);
+    EXPECT_EQ(stalemate.bestMove, NO_MOVE);
+    EXPECT_EQ(stalemate.info.score, DRAW_SCORE);
+
+    const SearchResult checkmate = searchPosition("7k/6Q1/6K1/8/8/8/8/8 b - - 0 1", 4);
+    EXPECT_EQ(checkmate.bestMove, NO_MOVE);
+    EXPECT_EQ(checkmate.info.score, -MATE_SCORE);
+}
+
+TEST(SearchTest, TestIterationReports)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    ChessEngine engine(1);
+    SearchLimits limits;
+    limits.depth = 4;
+
+    std::vector<SearchInfo> iterations;
+    const SearchResult result = engine.search(game, limits, [&](const SearchInfo &info) { iterations.push_back(info); });
+
+    ASSERT_EQ(iterations.size(), 4);
+    for (int j = 0; j < 4; ++j)
+    {
+        EXPECT_EQ(iterations[j].depth, j + 1);
+        EXPECT_FALSE(iterations[j].pv.empty());
+        EXPECT_GT(iterations[j].nodes, 0);
+    }
+
+    EXPECT_EQ(result.bestMove, iterations.back().pv.front());
+    EXPECT_EQ(game.getFEN(), "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+}
+
+TEST(SearchTest, TestNodeLimit)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    ChessEngine engine(1);
+    SearchLimits limits;
+    limits.nodes = 20000;
+
+    const SearchResult result = engine.search(game, limits);
+    EXPECT_NE(result.bestMove, NO_MOVE);
+    EXPECT_LT(result.info.nodes, 20000 + 2048);
+}
+
+TEST(SearchTest, TestLazySmp)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("k7/8/2K5/8/8/8/8/7R w - - 0 1"));
+
+    ChessEngine engine(4);
+    engine.setThreadCount(4);
+    EXPECT_EQ(engine.getThreadCount(), 4);
+
+    SearchLimits limits;
+    limits.depth = 5;
+
+    int iterations = 0;
+    const SearchResult result = engine.search(game, limits, [&](const SearchInfo &) { ++iterations; });
+    EXPECT_EQ(iterations, 5);
+    EXPECT_EQ(result.info.depth, 5);
+    EXPECT_EQ(result.info.score, MATE_SCORE - 3);
+    EXPECT_EQ(result.info.pv.front(), result.bestMove);
+
+    // Threads can't be turned off completely
+    engine.setThreadCount(0);
+    EXPECT_EQ(engine.getThreadCount(), 1);
+}
+
+TEST(SearchTest, TestSearchOptions)
+{
+    ChessGame game;
+    ASSERT_NO_THROW(game.createFromFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"));
+
+    SearchLimits limits;
+    limits.depth = 5;
+
+    ChessEngine engine(16);
+    const uint64_t selectiveNodes = engine.search(game, limits).info.nodes;
+
+    const SearchOptions noPruning{false, false, false, false, false};
+    engine.setSearchOptions(noPruning);
+    engine.newGame();
+    EXPECT_FALSE(engine.getSearchOptions().nullMovePruning);
+    const uint64_t fullWidthNodes = engine.search(game, limits).info.nodes;
+    EXPECT_LT(selectiveNodes, fullWidthNodes);
+
+    // Each technique on its own still finds the mate
+    ASSERT_NO_THROW(game.createFromFEN("k7/8/2K5/8/8/8/8/7R w - - 0 1"));
+    const SearchOptions single[] = {
+            {true, false, false, false, false}, {false, true, false, false, false}, {false, false, true, false, false},
+            {false, false, false, true, false}, {false, false, false, false, true},
+    };
+    for (const SearchOptions &options: single)
+    {
+        engine.setSearchOptions(options);
+        engine.newGame();
+        EXPECT_EQ(engine.search(game, limits).info.score, MATE_SCORE - 3);
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file transposition_table_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the shared transposition table
+ */
+#include "chess_engine/transposition_table.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "chess_engine/chess_error.h"
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+TEST(TranspositionTableTest, TestStoreAndProbe)
+{
+    TranspositionTable table(1);
+    EXPECT_EQ(table.getSize(), 1024 * 1024);
+    EXPECT_EQ(table.getEntryCount(), 1024 * 1024 / 16);
+
+    TTData data{};
+    EXPECT_FALSE(table.probe(0x1234, data));
+
+    table.store(0x1234, Move(11, 27, DOUBLE_PAWN_PUSH), -250, 31, 7, BOUND_LOWER);
+    ASSERT_TRUE(table.probe(0x1234, data));
+    EXPECT_EQ(data.move, Move(11, 27, DOUBLE_PAWN_PUSH));
+    EXPECT_EQ(data.score, -250);
+    EXPECT_EQ(data.eval, 31);
+    EXPECT_EQ(data.depth, 7);
+    EXPECT_EQ(data.bound, BOUND_LOWER);
+
+    // Same cluster, different key
+    EXPECT_FALSE(table.probe(0x1234 + (1ull << 40), data));
+
+    // A store without a move keeps the old one
+    table.store(0x1234, NO_MOVE, 12, 31, 8, BOUND_EXACT);
+    ASSERT_TRUE(table.probe(0x1234, data));
+    EXPECT_EQ(data.move, Move(11, 27, DOUBLE_PAWN_PUSH));
+    EXPECT_EQ(data.score, 12);
+
+    table.clear();
+    EXPECT_FALSE(table.probe(0x1234, data));
+}
+
+TEST(TranspositionTableTest, TestFailedResize)
+{
+    TranspositionTable table(1);
+    table.store(0x1234, Move(11, 27, DOUBLE_PAWN_PUSH), -250, 31, 7, BOUND_LOWER);
+
+    // A petabyte is more than the address space, the old table must survive the failure
+    EXPECT_THROW(table.resize(size_t(1) << 30), ChessError);
+    EXPECT_EQ(table.getSize(), 1024 * 1024);
+
+    TTData data{};
+    ASSERT_TRUE(table.probe(0x1234, data));
+    EXPECT_EQ(data.score, -250);
+    EXPECT_GE(table.getHashfull(), 0);
+}
+
+TEST(TranspositionTableTest, TestReplacement)
+{
+    TranspositionTable table(1);
+    const uint64_t clusterStride = table.getEntryCount() / 4;
+
+    // Fill one cluster, then a fifth position should push out the shallowest entry
+    for (int j = 0; j < 4; ++j)
+    {
+        table.store(5 + j * clusterStride, Move(1, 2), j, 0, 2 + j, BOUND_EXACT);
+    }
+    table.store(5 + 4 * clusterStride, Move(1, 2), 4, 0, 1, BOUND_EXACT);
+
+    TTData data{};
+    EXPECT_FALSE(table.probe(5, data));
+    EXPECT_TRUE(table.probe(5 + 3 * clusterStride, data));
+    EXPECT_TRUE(table.probe(5 + 4 * clusterStride, data));
+
+    // Entries from older searches go first, even if they are deeper
+    table.newSearch();
+    table.store(5 + 5 * clusterStride, Move(1, 2), 5, 0, 1, BOUND_EXACT);
+    table.store(5 + 6 * clusterStride, Move(1, 2), 6, 0, 1, BOUND_EXACT);
+    EXPECT_TRUE(table.probe(5 + 5 * clusterStride, data));
+    EXPECT_TRUE(table.probe(5 + 6 * clusterStride, data));
+    EXPECT_FALSE(table.probe(5 + 1 * clusterStride, data));
+}
+
+TEST(TranspositionTableTest, TestConcurrentAccess)
+{
+    TranspositionTable table(1);
+
+    // Every thread writes entries whose contents depend on the key, a torn entry must never be returned
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&table, t]() {
+            std::mt19937_64 random(t);
+            for (int j = 0; j < 100000; ++j)
+            {
+                const uint64_t key = random() & 0xffffff;
+                table.store(key, Move::fromValue(key & 0xffff), static_cast<int>(key % 1000), 0,
+                            static_cast<int>(key % 64), BOUND_EXACT);
+
+                TTData data{};
+                if (table.probe(key ^ 1, data))
+                {
+                    EXPECT_EQ(data.move.getValue(), (key ^ 1) & 0xffff);
+                    EXPECT_EQ(data.score, static_cast<int>((key ^ 1) % 1000));
+                }
+            }
+        });
+    }
+
+    for (auto &thread: threads)
+    {
+        thread.join();
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * @file tree_walker.cpp
+ * @author Matthew Brown
+ * @brief Walks every line of play for tests that check the position after each move
+ */
+#include "tree_walker.h"
+
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+using namespace chessengine::board;
+
+const std::vector<std::string> SPECIAL_MOVE_FENS = {
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        "n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+};
+
+namespace
+{
+
+void walkTree(ChessGame &game, int depth, const NodeCheck &check, Move move)
+{
+    check(game, move);
+    if (depth == 0 or testing::Test::HasFatalFailure())
+    {
+        return;
+    }
+
+    MoveList moves;
+    game.generateLegalMoves(moves);
+    for (const Move child: moves)
+    {
+        game.makeMove(child);
+        walkTree(game, depth - 1, check, child);
+        game.unmakeMove();
+
+        // An ASSERT in the check only leaves the check, the walk stops here
+        if (testing::Test::HasFatalFailure())
+        {
+            return;
+        }
+    }
+}
+
+} // namespace
+
+/** Make and take back every legal move down to a depth, checking the root and every position reached
+ *
+ * The game is back in its starting position afterwards. The walk stops at the first fatal failure.
+ *
+ * @param game Game to walk from
+ * @param depth Number of plies to walk
+ * @param check Test run on every position
+ */
+void walkTree(ChessGame &game, int depth, const NodeCheck &check) { walkTree(game, depth, check, NO_MOVE); }
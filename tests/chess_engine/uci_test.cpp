@@ -0,0 +1,139 @@
+/**
+ * @file uci_test.cpp
+ * @author Matthew Brown
+ * @brief Unit tests for the UCI front end
+ */
+#include "chess_engine/uci.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace chessengine;
+
+/** Count the lines of the output that start with a prefix */
+int countLines(const std::string &output, const std::string &prefix)
+{
+    std::istringstream stream(output);
+    int count = 0;
+    for (std::string line; std::getline(stream, line);)
+    {
+        count += line.starts_with(prefix);
+    }
+
+    return count;
+}
+
+TEST(UciTest, TestHandshake)
+{
+    std::ostringstream output;
+    Uci uci(output);
+    std::istringstream input("uci\nisready\nquit\nisready\n");
+    uci.run(input);
+
+    EXPECT_NE(output.str().find("id name "), std::string::npos);
+    EXPECT_NE(output.str().find("option name Hash type spin"), std::string::npos);
+    EXPECT_NE(output.str().find("uciok\nreadyok\n"), std::string::npos);
+
+    // Nothing is read after quit
+    EXPECT_EQ(countLines(output.str(), "readyok"), 1);
+}
+
+TEST(UciTest, TestGoDepth)
+{
+    std::ostringstream output;
+    Uci uci(output);
+    EXPECT_TRUE(uci.handleCommand("setoption name Hash value 1"));
+    EXPECT_TRUE(uci.handleCommand("position fen 6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1"));
+    EXPECT_TRUE(uci.handleCommand("go depth 3"));
+    uci.wait();
+    EXPECT_FALSE(uci.handleCommand("quit"));
+
+    EXPECT_EQ(countLines(output.str(), "info depth "), 3);
+    EXPECT_NE(output.str().find("info depth 3 seldepth "), std::string::npos);
+    EXPECT_NE(output.str().find(" hashfull "), std::string::npos);
+    EXPECT_NE(output.str().find("bestmove d1d8\n"), std::string::npos);
+}
+
+TEST(UciTest, TestPositionMoves)
+{
+    std::ostringstream output;
+    Uci uci(output);
+
+    // The rook would rather cut the king off on a7, but only the check may be searched
+    uci.handleCommand("position fen 7k/8/8/8/8/8/8/K6R b - - 0 1 moves h8g8 h1h7 g8f8");
+    uci.handleCommand("go depth 2 searchmoves h7h8");
+    uci.wait();
+    EXPECT_NE(output.str().find("bestmove h7h8"), std::string::npos);
+
+    uci.handleCommand("position startpos moves e2e5");
+    EXPECT_NE(output.str().find("info string Illegal move: e2e5"), std::string::npos);
+
+    // A FEN without kings is reported and the start position is used instead
+    uci.handleCommand("position fen 8/8/8/8/8/8/8/8 w - - 0 1");
+    EXPECT_NE(output.str().find("info string Invalid FEN: "), std::string::npos);
+    uci.handleCommand("go depth 1");
+    uci.wait();
+    EXPECT_EQ(countLines(output.str(), "bestmove "), 2);
+}
+
+TEST(UciTest, TestSetOption)
+{
+    std::ostringstream output;
+    Uci uci(output);
+
+    // Negative values are rejected instead of wrapping around to the maximum
+    EXPECT_TRUE(uci.handleCommand("setoption name Hash value -5"));
+    EXPECT_TRUE(uci.handleCommand("setoption name Threads value -1"));
+    EXPECT_TRUE(uci.handleCommand("setoption name Move Overhead value abc"));
+    EXPECT_EQ(countLines(output.str(), "info string Could not set "), 3);
+    EXPECT_NE(output.str().find("Could not set Hash: -5 is below the minimum of 1"), std::string::npos);
+
+    EXPECT_TRUE(uci.handleCommand("setoption name Threads value 2"));
+    EXPECT_TRUE(uci.handleCommand("go depth 3"));
+    uci.wait();
+    EXPECT_EQ(countLines(output.str(), "bestmove "), 1);
+}
+
+TEST(UciTest, TestStopInfinite)
+{
+    std::ostringstream output;
+    Uci uci(output);
+    uci.handleCommand("position startpos moves e2e4");
+    uci.handleCommand("go infinite");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The search checks the stop flag at every node, so it ends well within a millisecond
+    const auto start = std::chrono::steady_clock::now();
+    uci.handleCommand("stop");
+    uci.handleCommand("quit");
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+
+    EXPECT_EQ(countLines(output.str(), "bestmove "), 1);
+}
+
+TEST(UciTest, TestPonderHit)
+{
+    std::ostringstream output;
+    Uci uci(output);
+    uci.handleCommand("go ponder wtime 1000 btime 1000");
+
+    // While pondering the clock is ignored, the search is still running after its time ran out
+    std::this_thread::sleep_for(std::chrono::milliseconds(1200));
+    uci.handleCommand("isready");
+
+    // The clock starts at ponderhit, so the search still takes about its 32ms share of the time
+    const auto start = std::chrono::steady_clock::now();
+    uci.handleCommand("ponderhit");
+    uci.wait();
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(25));
+    uci.handleCommand("quit");
+
+    const std::string text = output.str();
+    ASSERT_NE(text.find("readyok"), std::string::npos);
+    ASSERT_NE(text.find("bestmove "), std::string::npos);
+    EXPECT_LT(text.find("readyok"), text.find("bestmove "));
+}
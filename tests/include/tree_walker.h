@@ -0,0 +1,24 @@
+/**
+ * @file tree_walker.h
+ * @author Matthew Brown
+ * @brief Walks every line of play for tests that check the position after each move
+ */
+#ifndef TREE_WALKER_H
+#define TREE_WALKER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "chess_engine/board/move.h"
+#include "chess_engine/chess_game.h"
+
+/* Castling, en passant and promotions all show up within a few plies of these */
+extern const std::vector<std::string> SPECIAL_MOVE_FENS;
+
+/* Called on every position of a walk with the move that led to it, NO_MOVE at the root */
+using NodeCheck = std::function<void(chessengine::ChessGame &game, chessengine::board::Move move)>;
+
+void walkTree(chessengine::ChessGame &game, int depth, const NodeCheck &check);
+
+#endif // TREE_WALKER_H